@@ -6,6 +6,10 @@
 #include "DeliVerbDSP.h"
 
 @interface DeliVerbAU : AUAudioUnit
+
+// Render timing statistics; safe to call from any thread
+- (DeliVerb::RenderMonitor::Snapshot)renderMonitorSnapshot;
+
 @end
 
 @interface DeliVerbAUViewController : AUViewController <AUAudioUnitFactory>
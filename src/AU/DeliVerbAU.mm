@@ -2,6 +2,7 @@
 #import "Parameters.h"
 #import "DeliVerbView.h"
 #include <memory>
+#include <vector>
 
 using namespace DeliVerb;
 
@@ -16,6 +17,7 @@ using namespace DeliVerb;
     AVAudioFormat *_format;
     AUAudioFrameCount _maxFrames;
     AUParameterTree *_paramTree;
+    std::vector<float> _monoScratch; // Right channel for mono busses, sized off the render thread
 }
 
 @synthesize parameterTree = _paramTree;
@@ -113,7 +115,8 @@ using namespace DeliVerb;
 
     _paramTree = [AUParameterTree createTreeWithChildren:@[delayGroup, reverbGroup, advancedGroup]];
 
-    // Parameter observer block
+    // Parameter observer block; may run on any thread while rendering. The
+    // DSP's parameter store hands the value to the render block at its next buffer.
     __weak DeliVerbAU *weakSelf = self;
     _paramTree.implementorValueObserver = ^(AUParameter *param, AUValue value) {
         __strong DeliVerbAU *strongSelf = weakSelf;
@@ -185,17 +188,30 @@ using namespace DeliVerb;
     _dsp->setSampleRate(sampleRate);
     _dsp->reset();
 
+    _monoScratch.assign(_maxFrames, 0.0f);
+
     return YES;
 }
 
 - (void)deallocateRenderResources {
+    RenderMonitor::Snapshot monitor = _dsp->renderMonitor().snapshot();
+    if (monitor.deadlineMisses > 0) {
+        NSLog(@"DeliVerb: %llu of %llu render blocks missed their deadline (worst load %.0f%%)",
+              monitor.deadlineMisses, monitor.blocks, monitor.worst.load * 100.0);
+    }
+
     [super deallocateRenderResources];
     _dsp->reset();
 }
 
+- (RenderMonitor::Snapshot)renderMonitorSnapshot {
+    return _dsp->renderMonitor().snapshot();
+}
+
 - (AUInternalRenderBlock)internalRenderBlock {
     // Capture DSP pointer for real-time thread
     DeliVerbDSP *dsp = _dsp.get();
+    std::vector<float> *monoScratch = &_monoScratch;
 
     return ^AUAudioUnitStatus(AudioUnitRenderActionFlags *actionFlags,
                               const AudioTimeStamp *timestamp,
@@ -224,9 +240,8 @@ using namespace DeliVerb;
         } else if (numChannels == 1) {
             // Mono - process and output stereo to same buffer
             float *buffer = (float *)outputData->mBuffers[0].mData;
-            static std::vector<float> tempR;
-            if (tempR.size() < frameCount) tempR.resize(frameCount);
-            dsp->process(buffer, buffer, tempR.data(), frameCount);
+            if (frameCount > monoScratch->size()) return kAudioUnitErr_TooManyFramesToProcess;
+            dsp->process(buffer, buffer, monoScratch->data(), frameCount);
         }
 
         return noErr;
@@ -2,6 +2,7 @@
 
 #include <AudioUnitSDK/AUEffectBase.h>
 #include "DeliVerbDSP.h"
+#include <vector>
 
 namespace DeliVerb {
 
@@ -15,6 +16,12 @@ public:
     void Cleanup() override;
     OSStatus Reset(AudioUnitScope inScope, AudioUnitElement inElement) override;
 
+    OSStatus SetParameter(AudioUnitParameterID inID,
+                          AudioUnitScope inScope,
+                          AudioUnitElement inElement,
+                          AudioUnitParameterValue inValue,
+                          UInt32 inBufferOffsetInFrames) override;
+
     OSStatus GetParameterInfo(AudioUnitScope inScope,
                               AudioUnitParameterID inParameterID,
                               AudioUnitParameterInfo& outParameterInfo) override;
@@ -36,8 +43,15 @@ public:
                                 AudioBufferList& outBuffer,
                                 UInt32 inFramesToProcess) override;
 
+    // Render timing statistics; safe to read from any thread
+    const RenderMonitor& GetRenderMonitor() const { return mDSP.renderMonitor(); }
+
 private:
     DeliVerbDSP mDSP;
+
+    // Right-channel scratch for mono buses, sized in Initialize() so the
+    // render thread never allocates
+    std::vector<float> mMonoScratch;
 };
 
 } // namespace DeliVerb
@@ -30,9 +30,11 @@ static const ParamInfo kParamInfos[] = {
     // Advanced delay parameters
     {"Delay Low Cut",  kAudioUnitParameterUnit_Hertz, 20.0f, 2000.0f, 80.0f},
     {"Delay High Cut", kAudioUnitParameterUnit_Hertz, 1000.0f, 20000.0f, 8000.0f},
+    {"Delay Scoop",    kAudioUnitParameterUnit_Generic, 0.0f, 1.0f, 0.0f},
     // Advanced reverb parameters
     {"Reverb Low Cut",  kAudioUnitParameterUnit_Hertz, 20.0f, 2000.0f, 100.0f},
     {"Reverb High Cut", kAudioUnitParameterUnit_Hertz, 1000.0f, 20000.0f, 10000.0f},
+    {"Reverb Scoop",    kAudioUnitParameterUnit_Generic, 0.0f, 1.0f, 0.0f},
     // Ducking parameters
     {"Duck Delay",     kAudioUnitParameterUnit_Generic, 0.0f, 1.0f, 0.0f},
     {"Duck Reverb",    kAudioUnitParameterUnit_Generic, 0.0f, 1.0f, 0.0f},
@@ -42,6 +44,7 @@ static const ParamInfo kParamInfos[] = {
 };
 
 static const int kNumParameters = sizeof(kParamInfos) / sizeof(kParamInfos[0]);
+static_assert(kNumParameters == DeliVerbDSP::kNumParams, "kParamInfos must cover every DSP ParamID");
 
 DeliVerbAUv2::DeliVerbAUv2(AudioComponentInstance inComponentInstance)
     : ausdk::AUEffectBase(inComponentInstance, true /* processes in place */)
@@ -63,6 +66,8 @@ OSStatus DeliVerbAUv2::Initialize()
     mDSP.setSampleRate(GetSampleRate());
     mDSP.reset();
 
+    mMonoScratch.assign(GetMaxFramesPerSlice(), 0.0f);
+
     return noErr;
 }
 
@@ -78,6 +83,21 @@ OSStatus DeliVerbAUv2::Reset(AudioUnitScope inScope, AudioUnitElement inElement)
     return AUEffectBase::Reset(inScope, inElement);
 }
 
+OSStatus DeliVerbAUv2::SetParameter(AudioUnitParameterID inID,
+                                     AudioUnitScope inScope,
+                                     AudioUnitElement inElement,
+                                     AudioUnitParameterValue inValue,
+                                     UInt32 inBufferOffsetInFrames)
+{
+    OSStatus result = AUEffectBase::SetParameter(inID, inScope, inElement, inValue, inBufferOffsetInFrames);
+    if (result != noErr || inScope != kAudioUnitScope_Global) return result;
+
+    // Forward on the host's thread so the coefficient math happens here,
+    // not in the next render call
+    mDSP.setParameter(static_cast<DeliVerbDSP::ParamID>(inID), inValue);
+    return noErr;
+}
+
 OSStatus DeliVerbAUv2::GetParameterInfo(AudioUnitScope inScope,
                                          AudioUnitParameterID inParameterID,
                                          AudioUnitParameterInfo& outParameterInfo)
@@ -154,7 +174,9 @@ OSStatus DeliVerbAUv2::ProcessBufferLists(AudioUnitRenderActionFlags& ioActionFl
                                            AudioBufferList& outBuffer,
                                            UInt32 inFramesToProcess)
 {
-    // Update parameters from AU state
+    // Safety net for values that reach the globals without SetParameter
+    // (state restore); values SetParameter already forwarded are one atomic
+    // load each here
     for (int i = 0; i < kNumParameters; ++i) {
         mDSP.setParameter(static_cast<DeliVerbDSP::ParamID>(i), GetParameter(i));
     }
@@ -182,11 +204,12 @@ OSStatus DeliVerbAUv2::ProcessBufferLists(AudioUnitRenderActionFlags& ioActionFl
         const float* inData = static_cast<const float*>(inBuffer.mBuffers[0].mData);
         float* outData = static_cast<float*>(outBuffer.mBuffers[0].mData);
 
-        // For mono, create a temp buffer for the right channel
-        static std::vector<float> tempR;
-        if (tempR.size() < inFramesToProcess) tempR.resize(inFramesToProcess);
+        // The right channel goes to preallocated scratch
+        if (inFramesToProcess > mMonoScratch.size()) {
+            return kAudioUnitErr_TooManyFramesToProcess;
+        }
 
-        mDSP.process(inData, outData, tempR.data(), inFramesToProcess);
+        mDSP.process(inData, outData, mMonoScratch.data(), inFramesToProcess);
     }
 
     return noErr;
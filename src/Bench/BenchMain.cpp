@@ -0,0 +1,78 @@
+// deliverb_bench - performance measurements for the DeliVerb DSP core
+//
+// Usage: deliverb_bench [mode] [--seconds S] [--trials N] [--cpu-ghz G] [--filter NAME] [mode args]
+// Mode-specific arguments are documented at the top of each mode's source file.
+
+#include "BenchUtils.h"
+
+namespace DeliVerb::Bench {
+int runPrimitivesBench(const BenchOptions& options);
+int runChainBench(const BenchOptions& options);
+int runTailBench(const BenchOptions& options);
+int runScalingBench(const BenchOptions& options);
+int runLifecycleBench(const BenchOptions& options);
+} // namespace DeliVerb::Bench
+
+using namespace DeliVerb::Bench;
+
+namespace {
+
+struct Mode {
+    const char* name;
+    const char* description;
+    int (*run)(const BenchOptions&);
+};
+
+const Mode kModes[] = {
+    {"primitives", "ns/sample, cycles/sample and realtime factor per DSP primitive", runPrimitivesBench},
+    {"chain",      "processStereo/process matrix over sample rate, block size and preset", runChainBench},
+    {"tail",       "CPU per second while a 30 s silent tail decays (denormal check)", runTailBench},
+    {"scaling",    "N instances across M pinned threads: throughput, cache interference, capacity", runScalingBench},
+    {"lifecycle",  "wall time and page faults of construction, setSampleRate and reset", runLifecycleBench},
+};
+
+void printUsage() {
+    std::printf("usage: deliverb_bench [mode] [--seconds S] [--trials N] [--cpu-ghz G] [--filter NAME]\n\nmodes:\n");
+    for (const Mode& mode : kModes) {
+        std::printf("  %-12s %s\n", mode.name, mode.description);
+    }
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    const Mode* mode = &kModes[0];
+    BenchOptions options;
+
+    for (int i = 1; i < argc; ++i) {
+        const std::string arg = argv[i];
+        const bool hasValue = i + 1 < argc;
+
+        if (arg == "--help" || arg == "-h") {
+            printUsage();
+            return 0;
+        } else if (arg == "--seconds" && hasValue) {
+            options.seconds = std::atof(argv[++i]);
+        } else if (arg == "--trials" && hasValue) {
+            options.trials = std::atoi(argv[++i]);
+        } else if (arg == "--cpu-ghz" && hasValue) {
+            options.cpuGHz = std::atof(argv[++i]);
+        } else if (arg == "--filter" && hasValue) {
+            options.filter = argv[++i];
+        } else if (i == 1 && arg[0] != '-') {
+            mode = nullptr;
+            for (const Mode& candidate : kModes) {
+                if (arg == candidate.name) mode = &candidate;
+            }
+            if (!mode) {
+                std::fprintf(stderr, "unknown mode '%s'\n", arg.c_str());
+                printUsage();
+                return 1;
+            }
+        } else {
+            options.args.push_back(arg);
+        }
+    }
+
+    return mode->run(options);
+}
@@ -0,0 +1,221 @@
+#pragma once
+
+#include "CycleCounter.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <vector>
+
+namespace DeliVerb::Bench {
+
+// Sample rates every benchmark reports against
+inline constexpr double kSampleRates[] = {44100.0, 48000.0, 96000.0, 192000.0};
+
+// Command line options shared by all benchmark modes
+struct BenchOptions {
+    double seconds = 1.0;     // Audio rendered per trial
+    int trials = 5;           // Best-of-N trials
+    double cpuGHz = 3.0;      // Used to estimate cycles when the counter is not cycle-based
+    std::string filter;       // Only run cases whose name contains this
+    std::vector<std::string> args; // Mode-specific arguments
+
+    bool matches(const std::string& name) const {
+        return filter.empty() || name.find(filter) != std::string::npos;
+    }
+
+    // Value of "--key value" in the mode-specific arguments
+    const char* option(const char* key) const {
+        for (size_t i = 0; i + 1 < args.size(); ++i) {
+            if (args[i] == key) return args[i + 1].c_str();
+        }
+        return nullptr;
+    }
+
+    bool flag(const char* key) const {
+        return std::find(args.begin(), args.end(), key) != args.end();
+    }
+};
+
+// Result of timing a kernel over a known number of samples
+struct Measurement {
+    double nsPerSample = 0.0;
+    double cyclesPerSample = 0.0;
+
+    // How many times faster than real time one instance runs at sampleRate
+    double realtimeFactor(double sampleRate) const {
+        return nsPerSample > 0.0 ? (1.0e9 / sampleRate) / nsPerSample : 0.0;
+    }
+};
+
+// Keeps the optimizer from discarding a computed value
+inline void doNotOptimize(float value) {
+    asm volatile("" : : "g"(value) : "memory");
+}
+
+// Deterministic white noise in [-amplitude, amplitude]
+inline std::vector<float> makeNoise(size_t numSamples, float amplitude = 0.5f, uint32_t seed = 0x12345678u) {
+    std::vector<float> buffer(numSamples);
+    uint32_t state = seed;
+    for (auto& sample : buffer) {
+        state = state * 1664525u + 1013904223u;
+        sample = amplitude * (static_cast<float>(state >> 8) / 8388608.0f - 1.0f);
+    }
+    return buffer;
+}
+
+// Time `kernel(numSamples)` which must process exactly numSamples samples.
+// Returns the best of options.trials runs after one warm-up run.
+template<typename Kernel>
+Measurement measure(const BenchOptions& options, size_t numSamples, Kernel&& kernel) {
+    using Clock = std::chrono::steady_clock;
+
+    kernel(numSamples); // warm-up: page in buffers, settle branch predictors
+
+    double bestNs = 1.0e300;
+    uint64_t bestTicks = 0;
+    for (int trial = 0; trial < std::max(1, options.trials); ++trial) {
+        const auto start = Clock::now();
+        const uint64_t startTicks = CycleCounter::now();
+        kernel(numSamples);
+        const uint64_t endTicks = CycleCounter::now();
+        const double ns = std::chrono::duration<double, std::nano>(Clock::now() - start).count();
+        if (ns < bestNs) {
+            bestNs = ns;
+            bestTicks = endTicks - startTicks;
+        }
+    }
+
+    Measurement result;
+    result.nsPerSample = bestNs / static_cast<double>(numSamples);
+    if constexpr (CycleCounter::kCountsCycles) {
+        result.cyclesPerSample = static_cast<double>(bestTicks) / static_cast<double>(numSamples);
+    } else {
+        result.cyclesPerSample = result.nsPerSample * options.cpuGHz;
+    }
+    return result;
+}
+
+// Output formats for machine-readable results
+enum class OutputFormat { Table, CSV, JSON };
+
+inline OutputFormat parseFormat(const char* name) {
+    if (name && std::strcmp(name, "csv") == 0) return OutputFormat::CSV;
+    if (name && std::strcmp(name, "json") == 0) return OutputFormat::JSON;
+    return OutputFormat::Table;
+}
+
+// Rows of named columns that print as an aligned table, CSV or a JSON array
+class ResultTable {
+public:
+    struct Cell {
+        std::string text;
+        bool numeric = false;
+    };
+
+    explicit ResultTable(std::vector<std::string> columns) : m_columns(std::move(columns)) {}
+
+    static Cell text(std::string value) { return {std::move(value), false}; }
+
+    static Cell number(double value, int precision = 2) {
+        char buffer[64];
+        std::snprintf(buffer, sizeof(buffer), "%.*f", precision, value);
+        return {buffer, true};
+    }
+
+    void addRow(std::vector<Cell> row) {
+        row.resize(m_columns.size());
+        m_rows.push_back(std::move(row));
+    }
+
+    // Writes the table; `name` labels the JSON document
+    void write(FILE* out, OutputFormat format, const char* name) const {
+        switch (format) {
+            case OutputFormat::Table: writeTable(out); break;
+            case OutputFormat::CSV:   writeCSV(out); break;
+            case OutputFormat::JSON:  writeJSON(out, name); break;
+        }
+    }
+
+private:
+    void writeTable(FILE* out) const {
+        std::vector<size_t> widths;
+        for (const auto& column : m_columns) widths.push_back(column.size());
+        for (const auto& row : m_rows) {
+            for (size_t c = 0; c < row.size(); ++c) widths[c] = std::max(widths[c], row[c].text.size());
+        }
+
+        for (size_t c = 0; c < m_columns.size(); ++c) {
+            std::fprintf(out, c == 0 ? "%-*s" : "  %*s", static_cast<int>(widths[c]), m_columns[c].c_str());
+        }
+        std::fprintf(out, "\n");
+        for (const auto& row : m_rows) {
+            for (size_t c = 0; c < row.size(); ++c) {
+                std::fprintf(out, c == 0 ? "%-*s" : "  %*s", static_cast<int>(widths[c]), row[c].text.c_str());
+            }
+            std::fprintf(out, "\n");
+        }
+    }
+
+    void writeCSV(FILE* out) const {
+        for (size_t c = 0; c < m_columns.size(); ++c) {
+            std::fprintf(out, "%s%s", c ? "," : "", m_columns[c].c_str());
+        }
+        std::fprintf(out, "\n");
+        for (const auto& row : m_rows) {
+            for (size_t c = 0; c < row.size(); ++c) {
+                std::fprintf(out, "%s%s", c ? "," : "", row[c].text.c_str());
+            }
+            std::fprintf(out, "\n");
+        }
+    }
+
+    void writeJSON(FILE* out, const char* name) const {
+        std::fprintf(out, "{\n  \"benchmark\": \"%s\",\n", name);
+#ifdef DELIVERB_VERSION
+        std::fprintf(out, "  \"version\": \"%s\",\n", DELIVERB_VERSION);
+#endif
+        std::fprintf(out, "  \"cycle_unit\": \"%s\",\n  \"results\": [\n",
+                     CycleCounter::kCountsCycles ? "tsc" : "estimated");
+        for (size_t r = 0; r < m_rows.size(); ++r) {
+            std::fprintf(out, "    {");
+            for (size_t c = 0; c < m_columns.size(); ++c) {
+                const Cell& cell = m_rows[r][c];
+                std::fprintf(out, cell.numeric ? "%s\"%s\": %s" : "%s\"%s\": \"%s\"",
+                             c ? ", " : "", m_columns[c].c_str(), cell.text.c_str());
+            }
+            std::fprintf(out, "}%s\n", r + 1 < m_rows.size() ? "," : "");
+        }
+        std::fprintf(out, "  ]\n}\n");
+    }
+
+    std::vector<std::string> m_columns;
+    std::vector<std::vector<Cell>> m_rows;
+};
+
+// Opens --output if given, stdout otherwise
+inline FILE* openOutput(const BenchOptions& options) {
+    const char* path = options.option("--output");
+    if (!path) return stdout;
+    FILE* file = std::fopen(path, "w");
+    if (!file) {
+        std::fprintf(stderr, "cannot open %s, writing to stdout\n", path);
+        return stdout;
+    }
+    return file;
+}
+
+inline void closeOutput(FILE* file) {
+    if (file != stdout) std::fclose(file);
+}
+
+inline const char* cycleUnitNote() {
+    return CycleCounter::kCountsCycles ? "TSC reference cycles" : "estimated from --cpu-ghz";
+}
+
+} // namespace DeliVerb::Bench
@@ -0,0 +1,122 @@
+// Full-chain benchmark matrix: DeliVerbDSP::processStereo and the mono
+// process() path across sample rate, host block size and parameter preset.
+//
+// Mode args: --format table|csv|json  --output FILE
+//            --blocks 64,512  (default: 16..4096, powers of two)
+//            --trace FILE     Chrome trace of the last case (profiling builds;
+//                             narrow the matrix with --filter and --blocks)
+
+#include "BenchUtils.h"
+#include "Presets.h"
+
+#include <memory>
+
+namespace DeliVerb::Bench {
+
+namespace {
+
+// Host block sizes up to the AU's maximumFramesToRender (4096)
+constexpr int kDefaultBlockSizes[] = {16, 32, 64, 128, 256, 512, 1024, 2048, 4096};
+
+std::vector<int> parseBlockSizes(const char* list) {
+    std::vector<int> sizes;
+    if (!list) {
+        sizes.assign(std::begin(kDefaultBlockSizes), std::end(kDefaultBlockSizes));
+        return sizes;
+    }
+    for (const char* p = list; *p;) {
+        const int size = std::atoi(p);
+        if (size > 0) sizes.push_back(size);
+        while (*p && *p != ',') ++p;
+        if (*p == ',') ++p;
+    }
+    return sizes;
+}
+
+} // namespace
+
+int runChainBench(const BenchOptions& options) {
+    const OutputFormat format = parseFormat(options.option("--format"));
+    const std::vector<int> blockSizes = parseBlockSizes(options.option("--blocks"));
+    const int maxBlock = *std::max_element(blockSizes.begin(), blockSizes.end());
+
+    const std::vector<float> inputL = makeNoise(static_cast<size_t>(maxBlock), 0.5f, 1u);
+    const std::vector<float> inputR = makeNoise(static_cast<size_t>(maxBlock), 0.5f, 2u);
+    std::vector<float> outputL(maxBlock), outputR(maxBlock);
+
+    ResultTable table({"path", "preset", "sample_rate", "block_size",
+                       "ns_per_sample", "cycles_per_sample", "realtime_factor", "instances_per_core"});
+
+    for (const char* path : {"stereo", "mono"}) {
+        const bool stereo = path[0] == 's';
+
+        for (const Preset& preset : kPresets) {
+            const std::string caseName = std::string(path) + "/" + preset.name;
+            if (!options.matches(caseName)) continue;
+
+            for (double sampleRate : kSampleRates) {
+                auto dsp = std::make_unique<DeliVerbDSP>();
+                dsp->setSampleRate(sampleRate);
+                preset.applyTo(*dsp);
+                dsp->reset();
+
+                for (int blockSize : blockSizes) {
+                    auto kernel = [&](size_t n) {
+                        for (size_t done = 0; done < n; done += static_cast<size_t>(blockSize)) {
+                            const int count = static_cast<int>(std::min<size_t>(blockSize, n - done));
+                            if (stereo) {
+                                dsp->processStereo(inputL.data(), inputR.data(),
+                                                   outputL.data(), outputR.data(), count);
+                            } else {
+                                dsp->process(inputL.data(), outputL.data(), outputR.data(), count);
+                            }
+                        }
+                        doNotOptimize(outputL[0] + outputR[0]);
+                    };
+
+#if DELIVERB_PROFILING
+                    StageProfiler::instance().clear();
+#endif
+                    const size_t numSamples = static_cast<size_t>(sampleRate * options.seconds);
+                    const Measurement m = measure(options, numSamples, kernel);
+                    const double realtime = m.realtimeFactor(sampleRate);
+
+                    table.addRow({
+                        ResultTable::text(path),
+                        ResultTable::text(preset.name),
+                        ResultTable::number(sampleRate, 0),
+                        ResultTable::number(blockSize, 0),
+                        ResultTable::number(m.nsPerSample),
+                        ResultTable::number(m.cyclesPerSample, 1),
+                        ResultTable::number(realtime, 1),
+                        ResultTable::number(std::floor(realtime), 0),
+                    });
+                }
+            }
+        }
+    }
+
+    FILE* out = openOutput(options);
+    if (format == OutputFormat::Table) {
+        std::fprintf(out, "DeliVerb full-chain benchmark (best of %d, %.2f s audio per trial, cycles: %s)\n\n",
+                     options.trials, options.seconds, cycleUnitNote());
+    }
+    table.write(out, format, "chain");
+    closeOutput(out);
+
+    if (const char* tracePath = options.option("--trace")) {
+#if DELIVERB_PROFILING
+        if (FILE* trace = std::fopen(tracePath, "w")) {
+            StageProfiler::instance().writeChromeTrace(trace);
+            std::fclose(trace);
+            std::fprintf(stderr, "\nper-stage profile of the last case (trace: %s)\n", tracePath);
+            StageProfiler::instance().writeSummary(stderr);
+        }
+#else
+        std::fprintf(stderr, "--trace %s ignored: build with -DDELIVERB_ENABLE_PROFILING=ON\n", tracePath);
+#endif
+    }
+    return 0;
+}
+
+} // namespace DeliVerb::Bench
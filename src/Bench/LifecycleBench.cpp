@@ -0,0 +1,138 @@
+// Lifecycle latency benchmark: what project open and transport stop cost.
+// Times DeliVerbDSP construction, setSampleRate() on a fresh instance and as
+// a rate change, reset() and destruction, with the page faults each incurs.
+// The first trial is reported separately: it is the cold case a project open
+// actually sees, later trials may reuse memory the allocator kept around.
+//
+// Mode args: --format table|csv|json  --output FILE
+
+#include "BenchUtils.h"
+#include "DeliVerbDSP.h"
+
+#include <memory>
+
+#include <sys/resource.h>
+
+namespace DeliVerb::Bench {
+
+namespace {
+
+struct Sample {
+    double ns = 0.0;
+    long minorFaults = 0;
+    long majorFaults = 0;
+};
+
+// Wall time and page faults of one call
+template<typename Fn>
+Sample sample(Fn&& fn) {
+    using Clock = std::chrono::steady_clock;
+
+    rusage before{}, after{};
+    getrusage(RUSAGE_SELF, &before);
+    const auto start = Clock::now();
+    fn();
+    const double ns = std::chrono::duration<double, std::nano>(Clock::now() - start).count();
+    getrusage(RUSAGE_SELF, &after);
+    return {ns, after.ru_minflt - before.ru_minflt, after.ru_majflt - before.ru_majflt};
+}
+
+// First (cold) sample plus the best wall time over all trials
+struct Operation {
+    std::string name;
+    double sampleRate = 0.0;
+    Sample first;
+    double bestNs = 1.0e300;
+    size_t memoryBytes = 0;
+
+    void add(const Sample& s, bool isFirst) {
+        if (isFirst) first = s;
+        bestNs = std::min(bestNs, s.ns);
+    }
+};
+
+} // namespace
+
+int runLifecycleBench(const BenchOptions& options) {
+    const OutputFormat format = parseFormat(options.option("--format"));
+    const int numTrials = std::max(1, options.trials);
+
+    std::vector<Operation> operations;
+    auto operation = [&](const char* name, double sampleRate) -> Operation& {
+        for (Operation& op : operations) {
+            if (op.name == name && op.sampleRate == sampleRate) return op;
+        }
+        Operation& op = operations.emplace_back();
+        op.name = name;
+        op.sampleRate = sampleRate;
+        return op;
+    };
+
+    for (double sampleRate : kSampleRates) {
+        // A rate change always comes from a different rate; 48k is the common neighbour
+        const double previousRate = sampleRate == 48000.0 ? 44100.0 : 48000.0;
+        char changeName[64];
+        std::snprintf(changeName, sizeof(changeName), "setSampleRate (from %.0f)", previousRate);
+
+        for (int trial = 0; trial < numTrials; ++trial) {
+            const bool isFirst = trial == 0;
+            std::unique_ptr<DeliVerbDSP> dsp;
+
+            // Construction does not depend on the rate; the cold sample is the very first one
+            Sample s = sample([&] { dsp = std::make_unique<DeliVerbDSP>(); });
+            if (options.matches("construct")) {
+                operation("construct", 0.0).add(s, isFirst && sampleRate == kSampleRates[0]);
+            }
+
+            s = sample([&] { dsp->setSampleRate(sampleRate); });
+            if (options.matches("setSampleRate (fresh)")) {
+                Operation& op = operation("setSampleRate (fresh)", sampleRate);
+                op.add(s, isFirst);
+                op.memoryBytes = dsp->memoryBytes();
+            }
+
+            s = sample([&] { dsp->reset(); });
+            if (options.matches("reset")) operation("reset", sampleRate).add(s, isFirst);
+
+            s = sample([&] { dsp.reset(); });
+            if (options.matches("destroy")) operation("destroy", sampleRate).add(s, isFirst);
+
+            // Rate change on an instance that has already run at previousRate
+            dsp = std::make_unique<DeliVerbDSP>();
+            dsp->setSampleRate(previousRate);
+            dsp->reset();
+            s = sample([&] { dsp->setSampleRate(sampleRate); });
+            if (options.matches(changeName)) {
+                Operation& op = operation(changeName, sampleRate);
+                op.add(s, isFirst);
+                op.memoryBytes = dsp->memoryBytes();
+            }
+            doNotOptimize(dsp->getParameter(DeliVerbDSP::kDelayTime));
+        }
+    }
+
+    ResultTable table({"operation", "sample_rate", "first_us", "best_us",
+                       "first_minor_faults", "first_major_faults", "memory_mb"});
+    for (const Operation& op : operations) {
+        table.addRow({
+            ResultTable::text(op.name),
+            op.sampleRate > 0.0 ? ResultTable::number(op.sampleRate, 0) : ResultTable::text("-"),
+            ResultTable::number(op.first.ns / 1000.0, 1),
+            ResultTable::number(op.bestNs / 1000.0, 1),
+            ResultTable::number(static_cast<double>(op.first.minorFaults), 0),
+            ResultTable::number(static_cast<double>(op.first.majorFaults), 0),
+            op.memoryBytes ? ResultTable::number(static_cast<double>(op.memoryBytes) / (1024.0 * 1024.0), 1)
+                           : ResultTable::text("-"),
+        });
+    }
+
+    FILE* out = openOutput(options);
+    if (format == OutputFormat::Table) {
+        std::fprintf(out, "DeliVerb lifecycle benchmark (first = cold trial, best of %d)\n\n", numTrials);
+    }
+    table.write(out, format, "lifecycle");
+    closeOutput(out);
+    return 0;
+}
+
+} // namespace DeliVerb::Bench
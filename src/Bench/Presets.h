@@ -0,0 +1,95 @@
+#pragma once
+
+#include "DeliVerbDSP.h"
+
+#include <string_view>
+#include <utility>
+#include <vector>
+
+namespace DeliVerb::Bench {
+
+// Representative parameter sets used by the benchmarks and regression tests.
+// Anything not listed keeps the DeliVerbDSP default.
+struct Preset {
+    const char* name;
+    std::vector<std::pair<DeliVerbDSP::ParamID, float>> values;
+
+    void applyTo(DeliVerbDSP& dsp) const {
+        for (const auto& [param, value] : values) {
+            dsp.setParameter(param, value);
+        }
+    }
+};
+
+inline const Preset kPresets[] = {
+    {"Classic", {
+        {DeliVerbDSP::kDelayTime, 300.0f},
+        {DeliVerbDSP::kDelayRepeat, 0.3f},
+        {DeliVerbDSP::kDelayMix, 0.3f},
+        {DeliVerbDSP::kReverbSize, 0.5f},
+        {DeliVerbDSP::kReverbStyle, 0.0f},
+        {DeliVerbDSP::kReverbMix, 0.3f},
+    }},
+    {"Atmospheric", {
+        {DeliVerbDSP::kDelayTime, 350.0f},
+        {DeliVerbDSP::kDelayRepeat, 0.55f},
+        {DeliVerbDSP::kDelayMix, 0.35f},
+        {DeliVerbDSP::kReverbSize, 0.85f},
+        {DeliVerbDSP::kReverbStyle, 1.0f},
+        {DeliVerbDSP::kReverbMix, 0.5f},
+    }},
+    {"HeavyDucking", {
+        {DeliVerbDSP::kDelayTime, 250.0f},
+        {DeliVerbDSP::kDelayRepeat, 0.5f},
+        {DeliVerbDSP::kDelayMix, 0.5f},
+        {DeliVerbDSP::kReverbSize, 0.7f},
+        {DeliVerbDSP::kReverbStyle, 0.4f},
+        {DeliVerbDSP::kReverbMix, 0.5f},
+        {DeliVerbDSP::kDuckDelayAmount, 1.0f},
+        {DeliVerbDSP::kDuckReverbAmount, 1.0f},
+        {DeliVerbDSP::kDuckBehaviour, 0.5f},
+    }},
+    {"AllFilters", {
+        {DeliVerbDSP::kDelayTime, 200.0f},
+        {DeliVerbDSP::kDelayRepeat, 0.45f},
+        {DeliVerbDSP::kDelayMix, 0.4f},
+        {DeliVerbDSP::kReverbSize, 0.6f},
+        {DeliVerbDSP::kReverbStyle, 0.6f},
+        {DeliVerbDSP::kReverbMix, 0.4f},
+        {DeliVerbDSP::kDelayLowCut, 400.0f},
+        {DeliVerbDSP::kDelayHighCut, 3000.0f},
+        {DeliVerbDSP::kDelayScoopAmount, 1.0f},
+        {DeliVerbDSP::kReverbLowCut, 300.0f},
+        {DeliVerbDSP::kReverbHighCut, 4000.0f},
+        {DeliVerbDSP::kReverbScoopAmount, 1.0f},
+    }},
+};
+
+// Parameter identifiers, matching the AU parameter tree (Parameters.h)
+inline const char* parameterIdentifier(DeliVerbDSP::ParamID param) {
+    static const char* const kIdentifiers[DeliVerbDSP::kNumParams] = {
+        "delayTime", "delayRepeat", "delayMix",
+        "reverbSize", "reverbStyle", "reverbMix",
+        "delayLowCut", "delayHighCut", "delayScoopAmount",
+        "reverbLowCut", "reverbHighCut", "reverbScoopAmount",
+        "duckDelayAmount", "duckReverbAmount", "duckBehaviour",
+        "advanced",
+    };
+    return param >= 0 && param < DeliVerbDSP::kNumParams ? kIdentifiers[param] : "unknown";
+}
+
+inline int findParameter(std::string_view identifier) {
+    for (int i = 0; i < DeliVerbDSP::kNumParams; ++i) {
+        if (identifier == parameterIdentifier(static_cast<DeliVerbDSP::ParamID>(i))) return i;
+    }
+    return -1;
+}
+
+inline const Preset* findPreset(const char* name) {
+    for (const Preset& preset : kPresets) {
+        if (std::string_view(preset.name) == name) return &preset;
+    }
+    return nullptr;
+}
+
+} // namespace DeliVerb::Bench
@@ -0,0 +1,441 @@
+// Micro-benchmarks for the individual DSP building blocks.
+// Each primitive is timed in isolation at every supported sample rate so the
+// per-sample cost inside DeliVerbDSP::processStereo can be attributed.
+//
+// Mode args: --format table|csv|json  --output FILE
+
+#include "BenchUtils.h"
+#include "Biquad.h"
+#include "DelayLine.h"
+#include "Ducker.h"
+#include "LFO.h"
+#include "Reverb.h"
+#include "SmootherBank.h"
+#include "StateVariableFilter.h"
+
+#include <functional>
+#include <memory>
+
+namespace DeliVerb::Bench {
+
+namespace {
+
+constexpr size_t kInputLength = 4096; // Cycled through by every kernel
+
+struct PrimitiveCase {
+    const char* name;
+    // Builds a kernel for the given sample rate; the kernel processes n samples
+    std::function<std::function<void(size_t)>(double sampleRate, const std::vector<float>& input)> make;
+};
+
+std::vector<PrimitiveCase> makeCases() {
+    std::vector<PrimitiveCase> cases;
+
+    cases.push_back({"Biquad::process", [](double sampleRate, const std::vector<float>& input) {
+        auto filter = std::make_shared<Biquad>();
+        filter->setSampleRate(sampleRate);
+        filter->setCoefficients(Biquad::Type::LowPass, 8000.0, 0.707);
+        return std::function<void(size_t)>([filter, &input](size_t n) {
+            float acc = 0.0f;
+            for (size_t i = 0; i < n; ++i) {
+                acc += filter->process(input[i % kInputLength]);
+            }
+            doNotOptimize(acc);
+        });
+    }});
+
+    // State-space block path, in both precisions
+    auto addBlockBiquad = [&cases](const char* name, auto precision) {
+        using T = decltype(precision);
+        cases.push_back({name, [](double sampleRate, const std::vector<float>& input) {
+            auto filter = std::make_shared<BasicBiquad<T>>();
+            filter->setSampleRate(sampleRate);
+            filter->setCoefficients(Biquad::Type::LowPass, 8000.0, 0.707);
+            auto block = std::make_shared<std::vector<float>>(kInputLength);
+            return std::function<void(size_t)>([filter, block, &input](size_t n) {
+                for (size_t done = 0; done < n; done += kInputLength) {
+                    const size_t count = std::min(kInputLength, n - done);
+                    std::copy(input.begin(), input.begin() + count, block->begin());
+                    filter->processBlock(block->data(), static_cast<int>(count));
+                }
+                doNotOptimize((*block)[0]);
+            });
+        }});
+    };
+    addBlockBiquad("Biquad::processBlock", double{});
+    addBlockBiquad("Biquad<float>::processBlock", float{});
+
+    // A cutoff swept every sample: redesigning a Biquad vs retuning the SVF
+    cases.push_back({"Biquad::process swept", [](double sampleRate, const std::vector<float>& input) {
+        auto filter = std::make_shared<Biquad>();
+        return std::function<void(size_t)>([filter, sampleRate, &input](size_t n) {
+            float acc = 0.0f;
+            for (size_t i = 0; i < n; ++i) {
+                const double cutoff = 200.0 + 8.0 * static_cast<double>(i % kInputLength);
+                filter->setCoefficients(Biquad::design(Biquad::Type::LowPass, cutoff, 0.707, 0.0, sampleRate));
+                acc += filter->process(input[i % kInputLength]);
+            }
+            doNotOptimize(acc);
+        });
+    }});
+
+    cases.push_back({"StateVariableFilter::process", [](double sampleRate, const std::vector<float>& input) {
+        auto filter = std::make_shared<StateVariableFilter>();
+        filter->setSampleRate(sampleRate);
+        filter->setCutoff(8000.0f);
+        return std::function<void(size_t)>([filter, &input](size_t n) {
+            float acc = 0.0f;
+            for (size_t i = 0; i < n; ++i) {
+                acc += filter->process(input[i % kInputLength]);
+            }
+            doNotOptimize(acc);
+        });
+    }});
+
+    cases.push_back({"StateVariableFilter::process swept", [](double sampleRate, const std::vector<float>& input) {
+        auto filter = std::make_shared<StateVariableFilter>();
+        filter->setSampleRate(sampleRate);
+        return std::function<void(size_t)>([filter, &input](size_t n) {
+            float acc = 0.0f;
+            for (size_t i = 0; i < n; ++i) {
+                filter->setCutoff(200.0f + 8.0f * static_cast<float>(i % kInputLength));
+                acc += filter->process(input[i % kInputLength]);
+            }
+            doNotOptimize(acc);
+        });
+    }});
+
+    // Both channels of a pair; compare against two Biquad::process calls
+    cases.push_back({"StereoBiquad::process", [](double sampleRate, const std::vector<float>& input) {
+        auto filter = std::make_shared<StereoBiquad>();
+        filter->setCoefficients(Biquad::design(Biquad::Type::LowPass, 8000.0, 0.707, 0.0, sampleRate));
+        return std::function<void(size_t)>([filter, &input](size_t n) {
+            float acc = 0.0f;
+            for (size_t i = 0; i < n; ++i) {
+                float left = input[i % kInputLength];
+                float right = -left;
+                filter->process(left, right);
+                acc += left + right;
+            }
+            doNotOptimize(acc);
+        });
+    }});
+
+    // Three-stage tone stack; compare against three StereoBiquad::process calls
+    auto makeToneStack = [](double sampleRate) {
+        auto cascade = std::make_shared<StereoBiquadCascade<3>>();
+        cascade->setCoefficients(0, Biquad::design(Biquad::Type::HighPass, 100.0, 0.707, 0.0, sampleRate));
+        cascade->setCoefficients(1, Biquad::design(Biquad::Type::LowPass, 8000.0, 0.707, 0.0, sampleRate));
+        cascade->setCoefficients(2, Biquad::design(Biquad::Type::Peak, 500.0, 0.7, -6.0, sampleRate));
+        return cascade;
+    };
+
+    cases.push_back({"StereoBiquadCascade::process", [makeToneStack](double sampleRate, const std::vector<float>& input) {
+        auto cascade = makeToneStack(sampleRate);
+        return std::function<void(size_t)>([cascade, &input](size_t n) {
+            float acc = 0.0f;
+            for (size_t i = 0; i < n; ++i) {
+                float left = input[i % kInputLength];
+                float right = -left;
+                cascade->process(left, right);
+                acc += left + right;
+            }
+            doNotOptimize(acc);
+        });
+    }});
+
+    cases.push_back({"StereoBiquadCascade::block", [makeToneStack](double sampleRate, const std::vector<float>& input) {
+        auto cascade = makeToneStack(sampleRate);
+        auto left = std::make_shared<std::vector<float>>(kInputLength);
+        auto right = std::make_shared<std::vector<float>>(kInputLength);
+        return std::function<void(size_t)>([cascade, left, right, &input](size_t n) {
+            for (size_t done = 0; done < n; done += kInputLength) {
+                const size_t count = std::min(kInputLength, n - done);
+                std::copy(input.begin(), input.begin() + count, left->begin());
+                std::copy(input.begin(), input.begin() + count, right->begin());
+                cascade->processBlock(left->data(), right->data(), static_cast<int>(count));
+            }
+            doNotOptimize((*left)[0]);
+        });
+    }});
+
+    // 16 lanes, the reverb's comb damping; per sample for all lanes
+    auto addMultiBiquad = [&cases](const char* name, auto precision) {
+        using T = decltype(precision);
+        cases.push_back({name, [](double sampleRate, const std::vector<float>& input) {
+            auto filter = std::make_shared<MultiBiquad<T, 16>>();
+            filter->setCoefficients(Biquad::design(Biquad::Type::LowPass, 6000.0, 0.707, 0.0, sampleRate));
+            return std::function<void(size_t)>([filter, &input](size_t n) {
+                float acc = 0.0f;
+                alignas(16) float lanes[16];
+                for (size_t i = 0; i < n; ++i) {
+                    for (int k = 0; k < 16; ++k) lanes[k] = input[(i + k) % kInputLength];
+                    filter->process(lanes);
+                    acc += lanes[0] + lanes[15];
+                }
+                doNotOptimize(acc);
+            });
+        }});
+    };
+    addMultiBiquad("MultiBiquad<float,16>", float{});
+    addMultiBiquad("MultiBiquad<double,16>", double{});
+
+    cases.push_back({"DelayLine::write", [](double sampleRate, const std::vector<float>& input) {
+        auto delay = std::make_shared<DelayLine>();
+        delay->setSampleRate(sampleRate);
+        delay->setMaxDelayMs(2100.0f);
+        return std::function<void(size_t)>([delay, &input](size_t n) {
+            for (size_t i = 0; i < n; ++i) {
+                delay->write(input[i % kInputLength]);
+            }
+            doNotOptimize(delay->read(100.0f));
+        });
+    }});
+
+    cases.push_back({"DelayLine::read", [](double sampleRate, const std::vector<float>& input) {
+        auto delay = std::make_shared<DelayLine>();
+        delay->setSampleRate(sampleRate);
+        delay->setMaxDelayMs(2100.0f);
+        for (float sample : input) delay->write(sample);
+        return std::function<void(size_t)>([delay](size_t n) {
+            float acc = 0.0f;
+            for (size_t i = 0; i < n; ++i) {
+                acc += delay->read(30.0f + static_cast<float>(i & 63) * 0.37f);
+            }
+            doNotOptimize(acc);
+        });
+    }});
+
+    cases.push_back({"DelayLine::readSamples", [](double sampleRate, const std::vector<float>& input) {
+        auto delay = std::make_shared<DelayLine>();
+        delay->setSampleRate(sampleRate);
+        delay->setMaxDelayMs(2100.0f);
+        for (float sample : input) delay->write(sample);
+        return std::function<void(size_t)>([delay](size_t n) {
+            float acc = 0.0f;
+            for (size_t i = 0; i < n; ++i) {
+                acc += delay->readSamples(1300.0f + static_cast<float>(i & 63) * 16.3f);
+            }
+            doNotOptimize(acc);
+        });
+    }});
+
+    // The hot path: delays converted to samples up front
+    cases.push_back({"DelayLine::tap", [](double sampleRate, const std::vector<float>& input) {
+        auto delay = std::make_shared<DelayLine>();
+        delay->setSampleRate(sampleRate);
+        delay->setMaxDelayMs(2100.0f);
+        for (float sample : input) delay->write(sample);
+        return std::function<void(size_t)>([delay](size_t n) {
+            float acc = 0.0f;
+            for (size_t i = 0; i < n; ++i) {
+                acc += delay->tap(1300.0f + static_cast<float>(i & 63) * 16.3f);
+            }
+            doNotOptimize(acc);
+        });
+    }});
+
+    // Interpolation policies; compare against DelayLine::tap (linear)
+    auto addPolicyTap = [&cases](const char* name, auto policy, bool fourLanes) {
+        using Line = BasicDelayLine<decltype(policy)>;
+        cases.push_back({name, [fourLanes](double sampleRate, const std::vector<float>& input) {
+            auto delay = std::make_shared<Line>();
+            delay->setSampleRate(sampleRate);
+            delay->setMaxDelayMs(2100.0f);
+            for (float sample : input) delay->write(sample);
+            return std::function<void(size_t)>([delay, fourLanes](size_t n) {
+                float acc = 0.0f;
+                if (fourLanes) {
+                    // n taps, four per call
+                    alignas(16) float delays[4], lanes[4];
+                    for (size_t i = 0; i < n; i += 4) {
+                        for (int lane = 0; lane < 4; ++lane) {
+                            delays[lane] = 1300.0f + static_cast<float>((i + lane) & 63) * 16.3f;
+                        }
+                        delay->tap4(delays).store(lanes);
+                        acc += lanes[0] + lanes[1] + lanes[2] + lanes[3];
+                    }
+                } else {
+                    for (size_t i = 0; i < n; ++i) {
+                        acc += delay->tap(1300.0f + static_cast<float>(i & 63) * 16.3f);
+                    }
+                }
+                doNotOptimize(acc);
+            });
+        }});
+    };
+    addPolicyTap("DelayLine<None>::tap", NoInterpolation{}, false);
+    addPolicyTap("DelayLine<Hermite>::tap", HermiteInterpolation{}, false);
+    addPolicyTap("DelayLine<Lagrange>::tap", LagrangeInterpolation{}, false);
+    addPolicyTap("DelayLine<Allpass>::tap", AllpassInterpolation{}, false);
+    addPolicyTap("DelayLine::tap4", LinearInterpolation{}, true);
+    addPolicyTap("DelayLine<Hermite>::tap4", HermiteInterpolation{}, true);
+
+    // Block API in 256-sample blocks: read a fixed or per-sample delay, then
+    // write the block; compare against DelayLine::tap + DelayLine::write
+    auto addBlockDelay = [&cases](const char* name, bool modulated) {
+        cases.push_back({name, [modulated](double sampleRate, const std::vector<float>& input) {
+            constexpr int kBlock = 256;
+            auto delay = std::make_shared<DelayLine>();
+            delay->setSampleRate(sampleRate);
+            delay->setMaxDelayMs(2100.0f);
+            auto delays = std::make_shared<std::vector<float>>(kBlock);
+            for (int i = 0; i < kBlock; ++i) {
+                (*delays)[i] = 1300.0f + 40.0f * std::sin(static_cast<float>(i) * 0.0245f);
+            }
+            auto output = std::make_shared<std::vector<float>>(kBlock);
+            return std::function<void(size_t)>([delay, delays, output, modulated, &input](size_t n) {
+                for (size_t done = 0; done < n; done += kBlock) {
+                    const int count = static_cast<int>(std::min<size_t>(kBlock, n - done));
+                    if (modulated) {
+                        delay->readBlock(output->data(), count, delays->data());
+                    } else {
+                        delay->readBlock(output->data(), count, 1300.37f);
+                    }
+                    delay->writeBlock(input.data() + done % kInputLength, count);
+                }
+                doNotOptimize((*output)[0]);
+            });
+        }});
+    };
+    addBlockDelay("DelayLine::readBlock+writeBlock", false);
+    addBlockDelay("DelayLine::readBlock+writeBlock modulated", true);
+
+    cases.push_back({"EnvelopeFollower::process", [](double sampleRate, const std::vector<float>& input) {
+        auto follower = std::make_shared<EnvelopeFollower>();
+        follower->setSampleRate(sampleRate);
+        return std::function<void(size_t)>([follower, &input](size_t n) {
+            float acc = 0.0f;
+            for (size_t i = 0; i < n; ++i) {
+                acc += follower->process(input[i % kInputLength]);
+            }
+            doNotOptimize(acc);
+        });
+    }});
+
+    cases.push_back({"Ducker::process", [](double sampleRate, const std::vector<float>& input) {
+        auto ducker = std::make_shared<Ducker>();
+        ducker->setSampleRate(sampleRate);
+        ducker->setDelayAmount(0.7f);
+        ducker->setReverbAmount(0.5f);
+        return std::function<void(size_t)>([ducker, &input](size_t n) {
+            float acc = 0.0f;
+            for (size_t i = 0; i < n; ++i) {
+                float delayGain, reverbGain;
+                const float sample = input[i % kInputLength];
+                ducker->process(sample, -sample, delayGain, reverbGain);
+                acc += delayGain + reverbGain;
+            }
+            doNotOptimize(acc);
+        });
+    }});
+
+    cases.push_back({"LFO::process", [](double sampleRate, const std::vector<float>&) {
+        auto lfo = std::make_shared<LFO>();
+        lfo->setSampleRate(sampleRate);
+        lfo->setRate(0.7f);
+        return std::function<void(size_t)>([lfo](size_t n) {
+            float acc = 0.0f;
+            for (size_t i = 0; i < n; ++i) {
+                acc += lfo->process();
+            }
+            doNotOptimize(acc);
+        });
+    }});
+
+    // Eight lanes stepped every 16 samples, retargeted often enough that
+    // they never settle (the cost while a parameter is moving)
+    cases.push_back({"SmootherBank::advance", [](double sampleRate, const std::vector<float>& input) {
+        auto bank = std::make_shared<SmootherBank<8>>();
+        for (int k = 0; k < 8; ++k) {
+            bank->setTimeConstant(k, 10.0f, sampleRate, 16);
+            bank->setTolerance(k, 1.0e-5f);
+        }
+        return std::function<void(size_t)>([bank, &input](size_t n) {
+            float acc = 0.0f;
+            for (size_t i = 0; i < n; i += 16) {
+                if ((i & 1023) == 0) {
+                    for (int k = 0; k < 8; ++k) bank->setTarget(k, input[(i + k) % kInputLength]);
+                }
+                bank->advance();
+                acc += bank->value(0);
+            }
+            doNotOptimize(acc);
+        });
+    }});
+
+    cases.push_back({"Reverb::process", [](double sampleRate, const std::vector<float>& input) {
+        auto reverb = std::make_shared<Reverb>();
+        reverb->setSampleRate(sampleRate);
+        reverb->setSize(0.5f);
+        reverb->setStyle(0.5f);
+        return std::function<void(size_t)>([reverb, &input](size_t n) {
+            float acc = 0.0f;
+            for (size_t i = 0; i < n; ++i) {
+                float outL, outR;
+                const float sample = input[i % kInputLength];
+                reverb->process(sample, sample, outL, outR);
+                acc += outL + outR;
+            }
+            doNotOptimize(acc);
+        });
+    }});
+
+    // In 256-sample blocks; compare against Reverb::process
+    cases.push_back({"Reverb::processBlock", [](double sampleRate, const std::vector<float>& input) {
+        constexpr int kBlock = 256;
+        auto reverb = std::make_shared<Reverb>();
+        reverb->setSampleRate(sampleRate);
+        reverb->setSize(0.5f);
+        reverb->setStyle(0.5f);
+        auto output = std::make_shared<std::vector<float>>(2 * kBlock);
+        return std::function<void(size_t)>([reverb, output, &input](size_t n) {
+            for (size_t done = 0; done < n; done += kBlock) {
+                const int count = static_cast<int>(std::min<size_t>(kBlock, n - done));
+                const float* block = input.data() + done % kInputLength;
+                reverb->processBlock(block, block, output->data(), output->data() + kBlock, count);
+            }
+            doNotOptimize((*output)[0]);
+        });
+    }});
+
+    return cases;
+}
+
+} // namespace
+
+int runPrimitivesBench(const BenchOptions& options) {
+    const OutputFormat format = parseFormat(options.option("--format"));
+    const std::vector<float> input = makeNoise(kInputLength);
+
+    ResultTable table({"primitive", "sample_rate", "ns_per_sample", "cycles_per_sample", "realtime_factor"});
+
+    for (const auto& primitive : makeCases()) {
+        if (!options.matches(primitive.name)) continue;
+
+        for (double sampleRate : kSampleRates) {
+            auto kernel = primitive.make(sampleRate, input);
+            const size_t numSamples = static_cast<size_t>(sampleRate * options.seconds);
+            const Measurement m = measure(options, numSamples, kernel);
+
+            table.addRow({
+                ResultTable::text(primitive.name),
+                ResultTable::number(sampleRate, 0),
+                ResultTable::number(m.nsPerSample),
+                ResultTable::number(m.cyclesPerSample, 1),
+                ResultTable::number(m.realtimeFactor(sampleRate), 0),
+            });
+        }
+    }
+
+    FILE* out = openOutput(options);
+    if (format == OutputFormat::Table) {
+        std::fprintf(out, "DeliVerb primitive benchmarks (best of %d, %.2f s audio per trial, cycles: %s)\n\n",
+                     options.trials, options.seconds, cycleUnitNote());
+    }
+    table.write(out, format, "primitives");
+    closeOutput(out);
+    return 0;
+}
+
+} // namespace DeliVerb::Bench
@@ -0,0 +1,259 @@
+// Multi-instance scaling benchmark: N DeliVerbDSP instances spread across M
+// pinned threads, each thread processing its instances round-robin per host
+// buffer the way a DAW does. Shows how throughput scales with threads and how
+// much each instance slows down once N x delay memory no longer fits in cache.
+//
+// Mode args: --format table|csv|json  --output FILE
+//            --instances 1,4,16   instance counts (default 1,2,4,8,16,32)
+//            --threads 1,2        thread counts (default powers of two up to the core count)
+//            --block N            host buffer size (default 256)
+//            --rate HZ            sample rate (default 48000)
+//            --preset NAME        parameter preset (default Classic)
+
+#include "BenchUtils.h"
+#include "Presets.h"
+
+#include <barrier>
+#include <memory>
+#include <thread>
+
+#if defined(__linux__)
+#include <pthread.h>
+#include <sched.h>
+#endif
+
+namespace DeliVerb::Bench {
+
+namespace {
+
+constexpr int kDefaultInstanceCounts[] = {1, 2, 4, 8, 16, 32};
+
+std::vector<int> parseList(const char* list) {
+    std::vector<int> values;
+    for (const char* p = list; p && *p;) {
+        const int value = std::atoi(p);
+        if (value > 0) values.push_back(value);
+        while (*p && *p != ',') ++p;
+        if (*p == ',') ++p;
+    }
+    return values;
+}
+
+int coreCount() {
+    return std::max(1u, std::thread::hardware_concurrency());
+}
+
+// Pins the calling thread to one core; returns false where unsupported
+bool pinCurrentThread(int core) {
+#if defined(__linux__)
+    cpu_set_t set;
+    CPU_ZERO(&set);
+    CPU_SET(core % coreCount(), &set);
+    return pthread_setaffinity_np(pthread_self(), sizeof(set), &set) == 0;
+#else
+    (void)core;
+    return false;
+#endif
+}
+
+// Per-thread results, padded so workers never share a cache line
+struct alignas(64) WorkerResult {
+    std::chrono::steady_clock::time_point start, end;
+    double busyNs = 0.0;        // time spent rendering this trial
+    double worstCycleNs = 0.0;  // slowest buffer cycle (all instances on the thread)
+    int numInstances = 0;
+    bool pinned = false;
+};
+
+struct ScalingResult {
+    double wallNs = 0.0;
+    double nsPerInstanceSample = 0.0; // mean over threads
+    double worstCycleLoad = 0.0;      // worst buffer cycle / buffer duration
+    size_t memoryBytes = 0;
+    bool pinned = true;
+};
+
+ScalingResult runScalingCase(const BenchOptions& options, const Preset& preset,
+                             double sampleRate, int blockSize, int numThreads, int numInstances) {
+    using Clock = std::chrono::steady_clock;
+
+    const int numFrames = std::max(blockSize, static_cast<int>(sampleRate * options.seconds));
+    const int numTrials = std::max(1, options.trials);
+    const std::vector<float> inputL = makeNoise(static_cast<size_t>(blockSize), 0.5f, 1u);
+    const std::vector<float> inputR = makeNoise(static_cast<size_t>(blockSize), 0.5f, 2u);
+
+    std::vector<WorkerResult> results(numThreads);
+    std::vector<double> bestBusyNs(numThreads, 1.0e300);
+    std::vector<double> bestCycleNs(numThreads, 1.0e300);
+    std::vector<size_t> memoryBytes(numThreads, 0);
+    std::barrier sync(numThreads + 1);
+
+    auto worker = [&](int t) {
+        WorkerResult& result = results[t];
+        result.pinned = pinCurrentThread(t);
+
+        // Construct on the owning thread so delay memory is first touched there
+        std::vector<std::unique_ptr<DeliVerbDSP>> instances;
+        for (int i = t; i < numInstances; i += numThreads) {
+            auto dsp = std::make_unique<DeliVerbDSP>();
+            dsp->setSampleRate(sampleRate);
+            preset.applyTo(*dsp);
+            dsp->reset();
+            memoryBytes[t] += dsp->memoryBytes();
+            instances.push_back(std::move(dsp));
+        }
+        result.numInstances = static_cast<int>(instances.size());
+        std::vector<float> outputL(blockSize), outputR(blockSize);
+
+        // Trial 0 is a warm-up
+        for (int trial = 0; trial <= numTrials; ++trial) {
+            sync.arrive_and_wait();
+            result.start = Clock::now();
+            result.busyNs = 0.0;
+            result.worstCycleNs = 0.0;
+            for (int done = 0; done < numFrames; done += blockSize) {
+                const int count = std::min(blockSize, numFrames - done);
+                const auto cycleStart = Clock::now();
+                for (auto& dsp : instances) {
+                    dsp->processStereo(inputL.data(), inputR.data(), outputL.data(), outputR.data(), count);
+                }
+                const double ns = std::chrono::duration<double, std::nano>(Clock::now() - cycleStart).count();
+                result.busyNs += ns;
+                if (count == blockSize) result.worstCycleNs = std::max(result.worstCycleNs, ns);
+            }
+            doNotOptimize(outputL[0] + outputR[0]);
+            result.end = Clock::now();
+            sync.arrive_and_wait();
+        }
+    };
+
+    std::vector<std::thread> threads;
+    for (int t = 0; t < numThreads; ++t) {
+        threads.emplace_back(worker, t);
+    }
+
+    // Wall time spans the workers' own timestamps: the coordinating thread may
+    // be descheduled when the start barrier opens
+    double bestWallNs = 1.0e300;
+    for (int trial = 0; trial <= numTrials; ++trial) {
+        sync.arrive_and_wait();
+        sync.arrive_and_wait();
+        if (trial == 0) continue;
+
+        auto start = results[0].start;
+        auto end = results[0].end;
+        for (const WorkerResult& r : results) {
+            start = std::min(start, r.start);
+            end = std::max(end, r.end);
+        }
+        bestWallNs = std::min(bestWallNs, std::chrono::duration<double, std::nano>(end - start).count());
+        for (int t = 0; t < numThreads; ++t) {
+            bestBusyNs[t] = std::min(bestBusyNs[t], results[t].busyNs);
+            bestCycleNs[t] = std::min(bestCycleNs[t], results[t].worstCycleNs);
+        }
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+
+    ScalingResult result;
+    result.wallNs = bestWallNs;
+    const double cycleBudgetNs = 1.0e9 * blockSize / sampleRate;
+    int busyThreads = 0;
+    for (int t = 0; t < numThreads; ++t) {
+        result.memoryBytes += memoryBytes[t];
+        result.pinned = result.pinned && results[t].pinned;
+        if (results[t].numInstances == 0) continue;
+        result.nsPerInstanceSample += bestBusyNs[t] / (static_cast<double>(results[t].numInstances) * numFrames);
+        result.worstCycleLoad = std::max(result.worstCycleLoad, bestCycleNs[t] / cycleBudgetNs);
+        ++busyThreads;
+    }
+    result.nsPerInstanceSample /= std::max(1, busyThreads);
+    return result;
+}
+
+} // namespace
+
+int runScalingBench(const BenchOptions& options) {
+    const OutputFormat format = parseFormat(options.option("--format"));
+    const char* rateArg = options.option("--rate");
+    const char* blockArg = options.option("--block");
+    const char* presetArg = options.option("--preset");
+    const double sampleRate = rateArg ? std::atof(rateArg) : 48000.0;
+    const int blockSize = std::max(1, blockArg ? std::atoi(blockArg) : 256);
+
+    const Preset* preset = findPreset(presetArg ? presetArg : "Classic");
+    if (!preset) {
+        std::fprintf(stderr, "unknown preset '%s'\n", presetArg);
+        return 1;
+    }
+
+    std::vector<int> instanceCounts = parseList(options.option("--instances"));
+    if (instanceCounts.empty()) {
+        instanceCounts.assign(std::begin(kDefaultInstanceCounts), std::end(kDefaultInstanceCounts));
+    }
+    std::vector<int> threadCounts = parseList(options.option("--threads"));
+    if (threadCounts.empty()) {
+        for (int n = 1; n < coreCount(); n *= 2) threadCounts.push_back(n);
+        threadCounts.push_back(coreCount());
+    }
+
+    ResultTable table({"threads", "instances", "memory_mb", "ns_per_instance_sample", "slowdown_vs_single",
+                       "realtime_instances", "speedup_vs_1_thread", "worst_cycle_load", "instances_per_core"});
+
+    // Uncontended reference: one instance, one thread, hot cache
+    const double singleNs = runScalingCase(options, *preset, sampleRate, blockSize, 1, 1).nsPerInstanceSample;
+    const double audioNsPerFrame = 1.0e9 / sampleRate;
+
+    std::vector<double> singleThreadThroughput(instanceCounts.size(), 0.0);
+    bool pinned = true;
+    double loadedPerCore = 0.0;
+
+    for (int numThreads : threadCounts) {
+        for (size_t c = 0; c < instanceCounts.size(); ++c) {
+            const int numInstances = instanceCounts[c];
+            if (numInstances < numThreads) continue;
+
+            const ScalingResult r = runScalingCase(options, *preset, sampleRate, blockSize, numThreads, numInstances);
+            pinned = pinned && r.pinned;
+
+            // Instances' worth of real-time audio rendered per wall-clock second
+            const double numFrames = std::max<double>(blockSize, static_cast<int>(sampleRate * options.seconds));
+            const double throughput = numInstances * numFrames * audioNsPerFrame / r.wallNs;
+            if (numThreads == 1) singleThreadThroughput[c] = throughput;
+            const double speedup = singleThreadThroughput[c] > 0.0 ? throughput / singleThreadThroughput[c] : 0.0;
+
+            // Capacity from aggregate throughput so oversubscribed thread counts stay meaningful
+            const double perCore = std::floor(throughput / std::min(numThreads, coreCount()));
+            loadedPerCore = perCore; // last row is the most loaded configuration
+
+            table.addRow({
+                ResultTable::number(numThreads, 0),
+                ResultTable::number(numInstances, 0),
+                ResultTable::number(static_cast<double>(r.memoryBytes) / (1024.0 * 1024.0), 1),
+                ResultTable::number(r.nsPerInstanceSample),
+                ResultTable::number(r.nsPerInstanceSample / singleNs),
+                ResultTable::number(throughput, 1),
+                ResultTable::number(speedup),
+                ResultTable::number(r.worstCycleLoad, 3),
+                ResultTable::number(perCore, 0),
+            });
+        }
+    }
+
+    FILE* out = openOutput(options);
+    if (format == OutputFormat::Table) {
+        std::fprintf(out, "DeliVerb scaling benchmark (preset %s, %.0f Hz, buffer %d, %d cores, threads %s, best of %d)\n\n",
+                     preset->name, sampleRate, blockSize, coreCount(), pinned ? "pinned" : "unpinned",
+                     options.trials);
+    }
+    table.write(out, format, "scaling");
+    if (format == OutputFormat::Table) {
+        std::fprintf(out, "\ninstances per core at buffer size %d: %.0f (%.0f per machine) - single instance alone: %.0f\n",
+                     blockSize, loadedPerCore, loadedPerCore * coreCount(), std::floor(audioNsPerFrame / singleNs));
+    }
+    closeOutput(out);
+    return 0;
+}
+
+} // namespace DeliVerb::Bench
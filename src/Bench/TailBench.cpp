@@ -0,0 +1,136 @@
+// Tail-decay benchmark: one second of noise, then a long silent tail while
+// the delay feedback, comb filters, biquads and envelope decay toward zero.
+// Without denormal protection the tail is where CPU spikes; with it the
+// per-second cost should stay at or below the active second.
+//
+// Mode args: --format table|csv|json  --output FILE
+//            --tail S         silent tail length in seconds (default 30)
+//            --rate HZ        sample rate (default 48000)
+//            --block N        host block size (default 256)
+//            --per-second     one row per second instead of a summary per preset
+
+#include "BenchUtils.h"
+#include "Presets.h"
+
+#include <memory>
+
+namespace DeliVerb::Bench {
+
+namespace {
+
+struct TailProfile {
+    std::vector<double> nsPerSample; // per second of audio, [0] is the active second
+    double worstBlockLoad = 0.0;     // worst block time / block duration, tail only
+};
+
+TailProfile renderTail(const Preset& preset, double sampleRate, int blockSize, int tailSeconds) {
+    using Clock = std::chrono::steady_clock;
+
+    const int secondFrames = static_cast<int>(sampleRate);
+    const std::vector<float> noiseL = makeNoise(static_cast<size_t>(secondFrames), 0.5f, 1u);
+    const std::vector<float> noiseR = makeNoise(static_cast<size_t>(secondFrames), 0.5f, 2u);
+    const std::vector<float> silence(static_cast<size_t>(blockSize), 0.0f);
+    std::vector<float> outputL(blockSize), outputR(blockSize);
+
+    auto dsp = std::make_unique<DeliVerbDSP>();
+    dsp->setSampleRate(sampleRate);
+    preset.applyTo(*dsp);
+    dsp->reset();
+
+    const double blockNs = 1.0e9 * blockSize / sampleRate;
+    TailProfile profile;
+
+    for (int second = 0; second <= tailSeconds; ++second) {
+        double secondNs = 0.0;
+        for (int done = 0; done < secondFrames; done += blockSize) {
+            const int count = std::min(blockSize, secondFrames - done);
+            const float* inL = second == 0 ? noiseL.data() + done : silence.data();
+            const float* inR = second == 0 ? noiseR.data() + done : silence.data();
+
+            const auto start = Clock::now();
+            dsp->processStereo(inL, inR, outputL.data(), outputR.data(), count);
+            const double ns = std::chrono::duration<double, std::nano>(Clock::now() - start).count();
+
+            secondNs += ns;
+            if (second > 0 && count == blockSize) {
+                profile.worstBlockLoad = std::max(profile.worstBlockLoad, ns / blockNs);
+            }
+        }
+        doNotOptimize(outputL[0] + outputR[0]);
+        profile.nsPerSample.push_back(secondNs / secondFrames);
+    }
+    return profile;
+}
+
+} // namespace
+
+int runTailBench(const BenchOptions& options) {
+    const OutputFormat format = parseFormat(options.option("--format"));
+    const char* tailArg = options.option("--tail");
+    const char* rateArg = options.option("--rate");
+    const char* blockArg = options.option("--block");
+    const int tailSeconds = std::max(1, tailArg ? std::atoi(tailArg) : 30);
+    const double sampleRate = rateArg ? std::atof(rateArg) : 48000.0;
+    const int blockSize = std::max(1, blockArg ? std::atoi(blockArg) : 256);
+    const bool perSecond = options.flag("--per-second");
+
+    ResultTable table = perSecond
+        ? ResultTable({"preset", "second", "ns_per_sample"})
+        : ResultTable({"preset", "active_ns_per_sample", "tail_mean_ns_per_sample",
+                       "tail_max_ns_per_sample", "tail_max_vs_active", "tail_worst_block_load"});
+
+    for (const Preset& preset : kPresets) {
+        if (!options.matches(preset.name)) continue;
+
+        // Per second, keep the fastest trial so scheduler noise does not look like a cliff
+        TailProfile best;
+        for (int trial = 0; trial < std::max(1, options.trials); ++trial) {
+            TailProfile run = renderTail(preset, sampleRate, blockSize, tailSeconds);
+            if (best.nsPerSample.empty()) {
+                best = std::move(run);
+                continue;
+            }
+            for (size_t s = 0; s < run.nsPerSample.size(); ++s) {
+                best.nsPerSample[s] = std::min(best.nsPerSample[s], run.nsPerSample[s]);
+            }
+            best.worstBlockLoad = std::min(best.worstBlockLoad, run.worstBlockLoad);
+        }
+
+        if (perSecond) {
+            for (size_t s = 0; s < best.nsPerSample.size(); ++s) {
+                table.addRow({
+                    ResultTable::text(preset.name),
+                    ResultTable::number(static_cast<double>(s), 0),
+                    ResultTable::number(best.nsPerSample[s]),
+                });
+            }
+            continue;
+        }
+
+        const double active = best.nsPerSample[0];
+        double tailSum = 0.0, tailMax = 0.0;
+        for (size_t s = 1; s < best.nsPerSample.size(); ++s) {
+            tailSum += best.nsPerSample[s];
+            tailMax = std::max(tailMax, best.nsPerSample[s]);
+        }
+        table.addRow({
+            ResultTable::text(preset.name),
+            ResultTable::number(active),
+            ResultTable::number(tailSum / tailSeconds),
+            ResultTable::number(tailMax),
+            ResultTable::number(tailMax / active),
+            ResultTable::number(best.worstBlockLoad, 3),
+        });
+    }
+
+    FILE* out = openOutput(options);
+    if (format == OutputFormat::Table) {
+        std::fprintf(out, "DeliVerb tail-decay benchmark (1 s noise + %d s silence, %.0f Hz, block %d, best of %d)\n\n",
+                     tailSeconds, sampleRate, blockSize, options.trials);
+    }
+    table.write(out, format, "tail");
+    closeOutput(out);
+    return 0;
+}
+
+} // namespace DeliVerb::Bench
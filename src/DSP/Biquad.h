@@ -1,14 +1,59 @@
 #pragma once
 
+#include "Denormals.h"
+#include "Simd.h"
+#include <algorithm>
 #include <cmath>
 #include <array>
 
 namespace DeliVerb {
 
-// High-performance biquad filter with various filter types
-// Used for EQ, tone shaping, and filtering
-class Biquad {
+// Normalized transfer function (a0 = 1)
+struct BiquadCoefficients {
+    double b0 = 1.0, b1 = 0.0, b2 = 0.0;
+    double a1 = 0.0, a2 = 0.0;
+};
+
+// Linear glide between two coefficient sets, one step per processed sample.
+// Interpolating between two stable filters stays stable (the a1/a2
+// stability triangle is convex).
+class BiquadRamp {
 public:
+    // Glides current to target over the next numSamples steps
+    void start(const BiquadCoefficients& current, const BiquadCoefficients& target, int numSamples) {
+        const double scale = 1.0 / numSamples;
+        m_target = target;
+        m_step = {(target.b0 - current.b0) * scale, (target.b1 - current.b1) * scale,
+                  (target.b2 - current.b2) * scale, (target.a1 - current.a1) * scale,
+                  (target.a2 - current.a2) * scale};
+        m_remaining = numSamples;
+    }
+
+    // Advances current by one sample, landing exactly on the target
+    void step(BiquadCoefficients& current) {
+        if (--m_remaining == 0) {
+            current = m_target;
+            return;
+        }
+        current.b0 += m_step.b0;
+        current.b1 += m_step.b1;
+        current.b2 += m_step.b2;
+        current.a1 += m_step.a1;
+        current.a2 += m_step.a2;
+    }
+
+    void cancel() { m_remaining = 0; }
+    bool isActive() const { return m_remaining > 0; }
+    const BiquadCoefficients& target() const { return m_target; }
+
+private:
+    BiquadCoefficients m_target;
+    BiquadCoefficients m_step;
+    int m_remaining = 0;
+};
+
+// Filter types and the coefficient design shared by every biquad variant
+struct BiquadDesign {
     enum class Type {
         LowPass,
         HighPass,
@@ -20,22 +65,17 @@ public:
         AllPass
     };
 
-    Biquad() = default;
-
-    void setSampleRate(double sampleRate) {
-        m_sampleRate = sampleRate;
-    }
+    using Coefficients = BiquadCoefficients;
 
-    void setCoefficients(Type type, double frequency, double Q, double gainDB = 0.0) {
-        if (m_sampleRate <= 0.0) return;
-
-        const double omega = 2.0 * M_PI * frequency / m_sampleRate;
+    // RBJ cookbook design. Pure, so it can run on any thread
+    static Coefficients design(Type type, double frequency, double Q, double gainDB, double sampleRate) {
+        const double omega = 2.0 * M_PI * frequency / sampleRate;
         const double sinOmega = std::sin(omega);
         const double cosOmega = std::cos(omega);
         const double alpha = sinOmega / (2.0 * Q);
         const double A = std::pow(10.0, gainDB / 40.0);
 
-        double b0, b1, b2, a0, a1, a2;
+        double b0 = 1.0, b1 = 0.0, b2 = 0.0, a0 = 1.0, a1 = 0.0, a2 = 0.0;
 
         switch (type) {
             case Type::LowPass:
@@ -116,50 +156,387 @@ public:
         }
 
         // Normalize coefficients
-        m_b0 = b0 / a0;
-        m_b1 = b1 / a0;
-        m_b2 = b2 / a0;
-        m_a1 = a1 / a0;
-        m_a2 = a2 / a0;
+        Coefficients c;
+        c.b0 = b0 / a0;
+        c.b1 = b1 / a0;
+        c.b2 = b2 / a0;
+        c.a1 = a1 / a0;
+        c.a2 = a2 / a0;
+        return c;
     }
+};
+
+// High-performance biquad filter with various filter types
+// Used for EQ, tone shaping, and filtering. T is the precision of the
+// coefficients and state: double where float rounding would be audible
+// (low cutoffs, high Q), float where it is plenty. Design and ramps are
+// always computed in double.
+template<typename T>
+class BasicBiquad : public BiquadDesign {
+public:
+    BasicBiquad() = default;
+
+    void setSampleRate(double sampleRate) {
+        m_sampleRate = sampleRate;
+    }
+
+    void setCoefficients(Type type, double frequency, double Q, double gainDB = 0.0) {
+        if (m_sampleRate <= 0.0) return;
+        setCoefficients(design(type, frequency, Q, gainDB, m_sampleRate));
+    }
+
+    // Loads precomputed coefficients; keeps the filter state, cancels a ramp
+    void setCoefficients(const Coefficients& c) {
+        m_ramp.cancel();
+        loadCoefficients(c);
+    }
+
+    // Moves the coefficients linearly to target over the next numSamples
+    // calls to process(), landing on it exactly
+    void rampTo(const Coefficients& target, int numSamples) {
+        if (numSamples <= 1) {
+            setCoefficients(target);
+            return;
+        }
+        m_ramp.start(m_c, target, numSamples);
+    }
+
+    // Jumps to the end of a ramp in progress
+    void finishRamp() {
+        if (m_ramp.isActive()) setCoefficients(m_ramp.target());
+    }
+
+    bool isRamping() const { return m_ramp.isActive(); }
+
+    Coefficients coefficients() const { return m_c; }
 
     // Direct Form II Transposed - best numerical stability
+    // State is flushed so decaying tails never go denormal
     float process(float input) {
-        const double output = m_b0 * input + m_z1;
-        m_z1 = m_b1 * input - m_a1 * output + m_z2;
-        m_z2 = m_b2 * input - m_a2 * output;
+        if (m_ramp.isActive()) {
+            m_ramp.step(m_c);
+            loadCoefficients(m_c);
+        }
+
+        const T x = input;
+        const T output = m_b0 * x + m_z1;
+        m_z1 = flushDenormal(m_b1 * x - m_a1 * output + m_z2);
+        m_z2 = flushDenormal(m_b2 * x - m_a2 * output);
         return static_cast<float>(output);
     }
 
+    // Filters a block in place, kFrameSize samples at a time in state-space
+    // form: each output of a frame is a fixed linear combination of the
+    // state and the frame's inputs, so the outputs are computed in SIMD
+    // lanes and the recursion only runs once per frame. Matches process()
+    // to rounding error (not bit for bit). Samples during a coefficient
+    // ramp, and any leftover at the end, go through process().
     void processBlock(float* buffer, int numSamples) {
-        for (int i = 0; i < numSamples; ++i) {
+        int i = 0;
+        while (i < numSamples && m_ramp.isActive()) {
+            buffer[i] = process(buffer[i]);
+            ++i;
+        }
+        if (m_frameDirty) computeFrameMatrices();
+        for (; i + kFrameSize <= numSamples; i += kFrameSize) {
+            processFrame(buffer + i);
+        }
+        for (; i < numSamples; ++i) {
             buffer[i] = process(buffer[i]);
         }
     }
 
     void reset() {
-        m_z1 = 0.0;
-        m_z2 = 0.0;
+        m_z1 = 0;
+        m_z2 = 0;
     }
 
     // Copy coefficients from another biquad (useful for stereo processing)
-    void copyCoefficientsFrom(const Biquad& other) {
-        m_b0 = other.m_b0;
-        m_b1 = other.m_b1;
-        m_b2 = other.m_b2;
-        m_a1 = other.m_a1;
-        m_a2 = other.m_a2;
+    void copyCoefficientsFrom(const BasicBiquad& other) {
+        setCoefficients(other.coefficients());
     }
 
+    static constexpr int kFrameSize = 4;
+
 private:
+    using Vector = typename simd::VectorOf<T>::Type;
+    static_assert(kFrameSize % Vector::kSize == 0, "frames must fill whole vectors");
+
+    void loadCoefficients(const Coefficients& c) {
+        m_c = c;
+        m_b0 = static_cast<T>(c.b0);
+        m_b1 = static_cast<T>(c.b1);
+        m_b2 = static_cast<T>(c.b2);
+        m_a1 = static_cast<T>(c.a1);
+        m_a2 = static_cast<T>(c.a2);
+        m_frameDirty = true;
+    }
+
+    // DF2T as state space, s = (z1, z2):
+    //   y  = C s + D x          C = [1 0], D = b0
+    //   s' = A s + B x          A = [-a1 1; -a2 0], B = [b1 - a1 b0; b2 - a2 b0]
+    // Unrolled over a frame of K samples:
+    //   y[k]  = C A^k s + D x[k] + sum_{j<k} C A^(k-1-j) B x[j]
+    //   s[K]  = A^K s + sum_j A^(K-1-j) B x[j]
+    // Computed in double whatever T is.
+    void computeFrameMatrices() {
+        const Coefficients& c = m_c;
+        const double B[2] = {c.b1 - c.a1 * c.b0, c.b2 - c.a2 * c.b0};
+
+        // Row vectors C A^k, and the impulse response h[m] = C A^(m-1) B
+        double row[2] = {1.0, 0.0};
+        double impulse[kFrameSize];
+        impulse[0] = c.b0;
+        for (int k = 0; k < kFrameSize; ++k) {
+            m_stateToOutput[0][k] = static_cast<T>(row[0]);
+            m_stateToOutput[1][k] = static_cast<T>(row[1]);
+            if (k + 1 < kFrameSize) impulse[k + 1] = row[0] * B[0] + row[1] * B[1];
+            const double next0 = -c.a1 * row[0] - c.a2 * row[1];
+            row[1] = row[0];
+            row[0] = next0;
+        }
+        for (int j = 0; j < kFrameSize; ++j) {
+            for (int k = 0; k < kFrameSize; ++k) {
+                m_inputToOutput[j][k] = static_cast<T>(k >= j ? impulse[k - j] : 0.0);
+            }
+        }
+
+        // A^(K-1-j) B for each input, and A^K
+        double column[2] = {B[0], B[1]};
+        for (int j = kFrameSize - 1; j >= 0; --j) {
+            m_inputToState[j][0] = static_cast<T>(column[0]);
+            m_inputToState[j][1] = static_cast<T>(column[1]);
+            const double next0 = -c.a1 * column[0] + column[1];
+            column[1] = -c.a2 * column[0];
+            column[0] = next0;
+        }
+        double power[2][2] = {{1.0, 0.0}, {0.0, 1.0}};
+        for (int k = 0; k < kFrameSize; ++k) {
+            for (int col = 0; col < 2; ++col) {
+                const double top = -c.a1 * power[0][col] + power[1][col];
+                power[1][col] = -c.a2 * power[0][col];
+                power[0][col] = top;
+            }
+        }
+        for (int r = 0; r < 2; ++r) {
+            for (int col = 0; col < 2; ++col) m_stateToState[r][col] = static_cast<T>(power[r][col]);
+        }
+        m_frameDirty = false;
+    }
+
+    void processFrame(float* samples) {
+        T x[kFrameSize];
+        for (int j = 0; j < kFrameSize; ++j) x[j] = samples[j];
+
+        const Vector z1 = Vector::broadcast(m_z1);
+        const Vector z2 = Vector::broadcast(m_z2);
+        for (int v = 0; v < kFrameSize; v += Vector::kSize) {
+            Vector y = z1 * Vector::load(m_stateToOutput[0] + v) + z2 * Vector::load(m_stateToOutput[1] + v);
+            // Inputs after this vector's last sample contribute nothing
+            for (int j = 0; j < v + Vector::kSize; ++j) {
+                y = y + Vector::broadcast(x[j]) * Vector::load(m_inputToOutput[j] + v);
+            }
+            y.store(samples + v);
+        }
+
+        T s1 = m_stateToState[0][0] * m_z1 + m_stateToState[0][1] * m_z2;
+        T s2 = m_stateToState[1][0] * m_z1 + m_stateToState[1][1] * m_z2;
+        for (int j = 0; j < kFrameSize; ++j) {
+            s1 += m_inputToState[j][0] * x[j];
+            s2 += m_inputToState[j][1] * x[j];
+        }
+        m_z1 = flushDenormal(s1);
+        m_z2 = flushDenormal(s2);
+    }
+
     double m_sampleRate = 44100.0;
 
-    // Coefficients
-    double m_b0 = 1.0, m_b1 = 0.0, m_b2 = 0.0;
-    double m_a1 = 0.0, m_a2 = 0.0;
+    // Full-precision coefficients (ramps run on these), and the working copy
+    Coefficients m_c;
+    BiquadRamp m_ramp;
+    T m_b0 = 1, m_b1 = 0, m_b2 = 0;
+    T m_a1 = 0, m_a2 = 0;
+
+    // State (Direct Form II Transposed)
+    T m_z1 = 0, m_z2 = 0;
+
+    // processBlock() frame matrices, rebuilt after the coefficients change
+    alignas(16) T m_stateToOutput[2][kFrameSize] = {};
+    alignas(16) T m_inputToOutput[kFrameSize][kFrameSize] = {};
+    T m_inputToState[kFrameSize][2] = {};
+    T m_stateToState[2][2] = {};
+    bool m_frameDirty = true;
+};
+
+using Biquad = BasicBiquad<double>;
+
+// A left/right pair of biquads sharing one set of coefficients. Both
+// channels' state lives in one SIMD register, so each sample costs one
+// filter's worth of multiplies; output matches two Biquads bit for bit.
+class StereoBiquad {
+public:
+    using Coefficients = BiquadCoefficients;
+
+    void setCoefficients(const Coefficients& c) {
+        m_c = c;
+        m_ramp.cancel();
+        loadCoefficients();
+    }
+
+    // Same glide as Biquad::rampTo, applied to both channels
+    void rampTo(const Coefficients& target, int numSamples) {
+        if (numSamples <= 1) {
+            setCoefficients(target);
+            return;
+        }
+        m_ramp.start(m_c, target, numSamples);
+    }
+
+    void finishRamp() {
+        if (m_ramp.isActive()) setCoefficients(m_ramp.target());
+    }
+
+    bool isRamping() const { return m_ramp.isActive(); }
+
+    Coefficients coefficients() const { return m_c; }
+
+    // Filters one sample of each channel in place
+    void process(float& left, float& right) {
+        using simd::Double2;
+        if (m_ramp.isActive()) stepRamp();
+
+        const Double2 input = Double2::set(left, right);
+        const Double2 output = m_b0 * input + m_z1;
+        m_z1 = simd::flushDenormal(m_b1 * input - m_a1 * output + m_z2);
+        m_z2 = simd::flushDenormal(m_b2 * input - m_a2 * output);
+        left = static_cast<float>(output.lo());
+        right = static_cast<float>(output.hi());
+    }
+
+    // Filters a block of each channel in place; same as process() per sample
+    void processBlock(float* left, float* right, int numSamples) {
+        for (int i = 0; i < numSamples; ++i) {
+            process(left[i], right[i]);
+        }
+    }
+
+    void reset() {
+        m_z1 = simd::Double2::zero();
+        m_z2 = simd::Double2::zero();
+    }
+
+private:
+    // Kept out of line so process() stays small enough to inline
+    [[gnu::noinline]] void stepRamp() {
+        m_ramp.step(m_c);
+        loadCoefficients();
+    }
+
+    void loadCoefficients() {
+        m_b0 = simd::Double2::broadcast(m_c.b0);
+        m_b1 = simd::Double2::broadcast(m_c.b1);
+        m_b2 = simd::Double2::broadcast(m_c.b2);
+        m_a1 = simd::Double2::broadcast(m_c.a1);
+        m_a2 = simd::Double2::broadcast(m_c.a2);
+    }
+
+    Coefficients m_c;
+    BiquadRamp m_ramp;
+
+    // m_c broadcast to both lanes
+    simd::Double2 m_b0 = simd::Double2::broadcast(1.0);
+    simd::Double2 m_b1 = simd::Double2::zero();
+    simd::Double2 m_b2 = simd::Double2::zero();
+    simd::Double2 m_a1 = simd::Double2::zero();
+    simd::Double2 m_a2 = simd::Double2::zero();
+
+    // State (Direct Form II Transposed), left in the low lane
+    simd::Double2 m_z1 = simd::Double2::zero();
+    simd::Double2 m_z2 = simd::Double2::zero();
+};
+
+// NumLanes independent filters sharing one set of coefficients, with
+// coefficients and state in precision T, e.g. the reverb's 16 comb damping
+// filters. Each SIMD register holds 4 float lanes or 2 double lanes, so
+// float runs twice the lanes per instruction. Lane n matches a
+// BasicBiquad<T> fed the same samples, bit for bit.
+template<typename T, int NumLanes>
+class MultiBiquad {
+    using Vector = typename simd::VectorOf<T>::Type;
+    static constexpr int kNumVectors = NumLanes / Vector::kSize;
+    static_assert(NumLanes % Vector::kSize == 0, "lanes must fill whole vectors");
+
+public:
+    using Coefficients = BiquadCoefficients;
+
+    MultiBiquad() { loadCoefficients(); }
+
+    void setCoefficients(const Coefficients& c) {
+        m_c = c;
+        m_ramp.cancel();
+        loadCoefficients();
+    }
+
+    // Same glide as Biquad::rampTo, applied to every lane
+    void rampTo(const Coefficients& target, int numSamples) {
+        if (numSamples <= 1) {
+            setCoefficients(target);
+            return;
+        }
+        m_ramp.start(m_c, target, numSamples);
+    }
+
+    void finishRamp() {
+        if (m_ramp.isActive()) setCoefficients(m_ramp.target());
+    }
+
+    bool isRamping() const { return m_ramp.isActive(); }
+
+    Coefficients coefficients() const { return m_c; }
+
+    // Filters one sample per lane in place; samples[n] belongs to lane n
+    void process(float* samples) {
+        if (m_ramp.isActive()) stepRamp();
+
+        for (int v = 0; v < kNumVectors; ++v) {
+            const Vector input = Vector::load(samples + v * Vector::kSize);
+            const Vector output = m_b0 * input + m_z1[v];
+            m_z1[v] = simd::flushDenormal(m_b1 * input - m_a1 * output + m_z2[v]);
+            m_z2[v] = simd::flushDenormal(m_b2 * input - m_a2 * output);
+            output.store(samples + v * Vector::kSize);
+        }
+    }
+
+    void reset() {
+        for (int v = 0; v < kNumVectors; ++v) {
+            m_z1[v] = Vector::zero();
+            m_z2[v] = Vector::zero();
+        }
+    }
+
+private:
+    [[gnu::noinline]] void stepRamp() {
+        m_ramp.step(m_c);
+        loadCoefficients();
+    }
+
+    void loadCoefficients() {
+        m_b0 = Vector::broadcast(static_cast<T>(m_c.b0));
+        m_b1 = Vector::broadcast(static_cast<T>(m_c.b1));
+        m_b2 = Vector::broadcast(static_cast<T>(m_c.b2));
+        m_a1 = Vector::broadcast(static_cast<T>(m_c.a1));
+        m_a2 = Vector::broadcast(static_cast<T>(m_c.a2));
+    }
+
+    Coefficients m_c;
+    BiquadRamp m_ramp;
+
+    // m_c in precision T, broadcast to every lane
+    Vector m_b0, m_b1, m_b2, m_a1, m_a2;
 
     // State (Direct Form II Transposed)
-    double m_z1 = 0.0, m_z2 = 0.0;
+    Vector m_z1[kNumVectors] = {};
+    Vector m_z2[kNumVectors] = {};
 };
 
 // Cascaded biquad for higher-order filters (e.g., Linkwitz-Riley)
@@ -213,4 +590,168 @@ private:
     std::array<Biquad, NumStages> m_stages;
 };
 
+// A fused chain of up to MaxStages second-order sections with left/right in
+// SIMD lanes, for tone stacks. All stage state sits in one contiguous array.
+// A stage whose transfer function is exactly unity (b0 = 1, b1 = a1,
+// b2 = a2, e.g. a peak at 0 dB) is skipped once its state has drained to
+// zero, at which point processing it would return its input unchanged. The
+// output therefore matches the same StereoBiquads run one after another, bit
+// for bit.
+template<int MaxStages>
+class StereoBiquadCascade {
+    static_assert(MaxStages > 0 && MaxStages <= 32, "stage masks are 32-bit words");
+
+public:
+    using Coefficients = BiquadCoefficients;
+
+    StereoBiquadCascade() { updateActiveStages(); }
+
+    void setCoefficients(int stage, const Coefficients& c) {
+        m_ramps[stage].cancel();
+        loadStage(stage, c);
+        updateActiveStages();
+    }
+
+    // Same glide as Biquad::rampTo, per stage
+    void rampTo(int stage, const Coefficients& target, int numSamples) {
+        if (numSamples <= 1) {
+            setCoefficients(stage, target);
+            return;
+        }
+        m_ramps[stage].start(m_coeffs[stage], target, numSamples);
+        updateActiveStages();
+    }
+
+    void finishRamp() {
+        for (int s = 0; s < MaxStages; ++s) {
+            if (m_ramps[s].isActive()) setCoefficients(s, m_ramps[s].target());
+        }
+    }
+
+    Coefficients coefficients(int stage) const { return m_coeffs[stage]; }
+
+    // Stages currently being processed (the rest are unity and drained)
+    int activeStages() const { return m_numActive; }
+
+    // Filters one sample of each channel in place
+    void process(float& left, float& right) {
+        simd::Double2 x = simd::Double2::set(left, right);
+        for (int k = 0; k < m_numActive; ++k) {
+            x = processStage(m_active[k], x);
+        }
+        left = static_cast<float>(x.lo());
+        right = static_cast<float>(x.hi());
+        if (m_updatePending) updateActiveStages();
+    }
+
+    // Filters a block in place. Stages run as a pipeline: in each iteration
+    // stage k works on sample i - k, so the stages' recursions are
+    // independent of each other and overlap instead of waiting on one
+    // another. Same result as calling process() per sample.
+    void processBlock(float* left, float* right, int numSamples) {
+        const int numActive = m_numActive;
+        if (numActive == 0) return;
+
+        simd::Double2 pipe[MaxStages]; // pipe[k]: sample waiting for stage k
+        const int last = numActive - 1;
+
+        // Stage k on sample i - k; back to front, so each stage consumes the
+        // previous iteration's output
+        auto run = [&](int i, int firstStage, int lastStage) {
+            for (int k = lastStage; k >= firstStage; --k) {
+                const int sample = i - k;
+                const simd::Double2 in = k == 0 ? simd::Double2::set(left[sample], right[sample]) : pipe[k];
+                const simd::Double2 out = processStage(m_active[k], in);
+                if (k == last) {
+                    left[sample] = static_cast<float>(out.lo());
+                    right[sample] = static_cast<float>(out.hi());
+                } else {
+                    pipe[k + 1] = out;
+                }
+            }
+        };
+
+        // Fill the pipeline, run it full, then drain it
+        for (int i = 0; i < std::min(last, numSamples); ++i) run(i, 0, i);
+        for (int i = last; i < numSamples; ++i) run(i, 0, last);
+        for (int i = numSamples; i < numSamples + last; ++i) {
+            run(i, i - numSamples + 1, std::min(i, last));
+        }
+        if (m_updatePending) updateActiveStages();
+    }
+
+    void reset() {
+        for (auto& stage : m_stages) {
+            stage.z1 = simd::Double2::zero();
+            stage.z2 = simd::Double2::zero();
+        }
+        updateActiveStages();
+    }
+
+private:
+    // Coefficients broadcast to both lanes, plus both channels' DF2T state
+    struct Stage {
+        simd::Double2 b0 = simd::Double2::broadcast(1.0);
+        simd::Double2 b1 = simd::Double2::zero();
+        simd::Double2 b2 = simd::Double2::zero();
+        simd::Double2 a1 = simd::Double2::zero();
+        simd::Double2 a2 = simd::Double2::zero();
+        simd::Double2 z1 = simd::Double2::zero();
+        simd::Double2 z2 = simd::Double2::zero();
+    };
+
+    static bool isUnity(const Coefficients& c) {
+        return c.b0 == 1.0 && c.b1 == c.a1 && c.b2 == c.a2;
+    }
+
+    // One sample through stage s. The output is rounded to float, which is
+    // what separate filters handed each other.
+    simd::Double2 processStage(int s, simd::Double2 input) {
+        if (m_ramps[s].isActive()) stepRamp(s);
+
+        Stage& st = m_stages[s];
+        const simd::Double2 output = st.b0 * input + st.z1;
+        st.z1 = simd::flushDenormal(st.b1 * input - st.a1 * output + st.z2);
+        st.z2 = simd::flushDenormal(st.b2 * input - st.a2 * output);
+        return simd::roundToFloat(output);
+    }
+
+    [[gnu::noinline]] void stepRamp(int s) {
+        m_ramps[s].step(m_coeffs[s]);
+        loadStage(s, m_coeffs[s]);
+        if (!m_ramps[s].isActive()) m_updatePending = true;
+    }
+
+    void loadStage(int s, const Coefficients& c) {
+        m_coeffs[s] = c;
+        m_stages[s].b0 = simd::Double2::broadcast(c.b0);
+        m_stages[s].b1 = simd::Double2::broadcast(c.b1);
+        m_stages[s].b2 = simd::Double2::broadcast(c.b2);
+        m_stages[s].a1 = simd::Double2::broadcast(c.a1);
+        m_stages[s].a2 = simd::Double2::broadcast(c.a2);
+    }
+
+    // Rebuilds the list of stages to run. A unity stage that still holds
+    // state keeps running and is re-checked after every call until it drains.
+    void updateActiveStages() {
+        m_numActive = 0;
+        m_updatePending = false;
+        for (int s = 0; s < MaxStages; ++s) {
+            const bool drained = simd::allZero(m_stages[s].z1) && simd::allZero(m_stages[s].z2);
+            const bool unity = isUnity(m_coeffs[s]) && !m_ramps[s].isActive();
+            if (unity && drained) continue;
+            if (unity) m_updatePending = true;
+            m_active[m_numActive++] = s;
+        }
+    }
+
+    Stage m_stages[MaxStages];
+    Coefficients m_coeffs[MaxStages];
+    BiquadRamp m_ramps[MaxStages];
+
+    int m_active[MaxStages] = {}; // Stages to run, in order
+    int m_numActive = 0;
+    bool m_updatePending = false; // A ramp ended or a unity stage is draining
+};
+
 } // namespace DeliVerb
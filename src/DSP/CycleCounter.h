@@ -0,0 +1,53 @@
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+
+#if defined(__x86_64__) || defined(_M_X64) || defined(__i386__)
+#include <x86intrin.h>
+#endif
+
+namespace DeliVerb {
+
+// Cheap monotonic tick source for measuring DSP cost
+// x86: time-stamp counter (constant-rate reference cycles)
+// arm64: virtual counter (fixed frequency, coarser than core cycles)
+// Elsewhere: steady_clock nanoseconds
+struct CycleCounter {
+#if defined(__x86_64__) || defined(_M_X64) || defined(__i386__)
+    static constexpr bool kCountsCycles = true;
+    static inline uint64_t now() { return __rdtsc(); }
+#elif defined(__aarch64__)
+    static constexpr bool kCountsCycles = false;
+    static inline uint64_t now() {
+        uint64_t value;
+        asm volatile("mrs %0, cntvct_el0" : "=r"(value));
+        return value;
+    }
+#else
+    static constexpr bool kCountsCycles = false;
+    static inline uint64_t now() {
+        return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::chrono::steady_clock::now().time_since_epoch()).count());
+    }
+#endif
+
+    // Ticks per second, measured once against steady_clock (~20 ms)
+    static double ticksPerSecond() {
+        static const double rate = calibrate();
+        return rate;
+    }
+
+private:
+    static double calibrate() {
+        using Clock = std::chrono::steady_clock;
+        const auto startTime = Clock::now();
+        const uint64_t startTicks = now();
+        while (Clock::now() - startTime < std::chrono::milliseconds(20)) {}
+        const uint64_t endTicks = now();
+        const double seconds = std::chrono::duration<double>(Clock::now() - startTime).count();
+        return static_cast<double>(endTicks - startTicks) / seconds;
+    }
+};
+
+} // namespace DeliVerb
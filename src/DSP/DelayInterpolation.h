@@ -0,0 +1,125 @@
+#pragma once
+
+#include "Simd.h"
+#include <type_traits>
+
+namespace DeliVerb {
+
+// Fractional-delay interpolators for BasicDelayLine. Each policy reads
+// kTaps consecutive samples: taps[0] is the newest, kNewer samples newer than
+// the whole-sample delay, and frac moves the read point from taps[kNewer]
+// toward the next older tap. V is float for tap(), simd::Float4 for tap4().
+//
+// kRounding is added to the delay before it is split, so NoInterpolation
+// reads the nearest sample; kMinDelay keeps the newest tap off the slot the
+// next write() will fill.
+
+namespace interpolation_detail {
+template<typename V> V splat(float x) {
+    if constexpr (std::is_same_v<V, float>) return x;
+    else return V::broadcast(x);
+}
+} // namespace interpolation_detail
+
+// Nearest sample. For delays that never move or only jump.
+struct NoInterpolation {
+    static constexpr int kNewer = 0;
+    static constexpr int kTaps = 1;
+    static constexpr float kRounding = 0.5f;
+    static constexpr float kMinDelay = 1.0f;
+
+    template<typename V> V operator()(const V* taps, V) const { return taps[0]; }
+    void reset() {}
+};
+
+// Two taps. Cheap and never overshoots, but dulls the top octave when the
+// fraction sits near one half, and the dulling moves with modulation.
+struct LinearInterpolation {
+    static constexpr int kNewer = 0;
+    static constexpr int kTaps = 2;
+    static constexpr float kRounding = 0.0f;
+    static constexpr float kMinDelay = 1.0f;
+
+    template<typename V> V operator()(const V* taps, V frac) const {
+        using interpolation_detail::splat;
+        return taps[0] * (splat<V>(1.0f) - frac) + taps[1] * frac;
+    }
+    void reset() {}
+};
+
+// Four-point cubic Hermite (Catmull-Rom). Flat response far higher than
+// linear; the choice for modulated delay times.
+struct HermiteInterpolation {
+    static constexpr int kNewer = 1;
+    static constexpr int kTaps = 4;
+    static constexpr float kRounding = 0.0f;
+    static constexpr float kMinDelay = 2.0f;
+
+    template<typename V> V operator()(const V* taps, V frac) const {
+        using interpolation_detail::splat;
+        const V newer = taps[0], x0 = taps[1], x1 = taps[2], x2 = taps[3];
+        const V c1 = splat<V>(0.5f) * (x1 - newer);
+        const V c2 = newer - splat<V>(2.5f) * x0 + splat<V>(2.0f) * x1 - splat<V>(0.5f) * x2;
+        const V c3 = splat<V>(0.5f) * (x2 - newer) + splat<V>(1.5f) * (x0 - x1);
+        return ((c3 * frac + c2) * frac + c1) * frac + x0;
+    }
+    void reset() {}
+};
+
+// Four-point third-order Lagrange. Maximally flat at DC; slightly more
+// high-frequency droop than Hermite, exact on cubic signals.
+struct LagrangeInterpolation {
+    static constexpr int kNewer = 1;
+    static constexpr int kTaps = 4;
+    static constexpr float kRounding = 0.0f;
+    static constexpr float kMinDelay = 2.0f;
+
+    template<typename V> V operator()(const V* taps, V frac) const {
+        using interpolation_detail::splat;
+        const V one = splat<V>(1.0f), two = splat<V>(2.0f);
+        const V dm1 = frac + one, d1 = frac - one, d2 = frac - two;
+        const V sixth = splat<V>(1.0f / 6.0f), half = splat<V>(0.5f);
+        return taps[1] * (dm1 * d1 * d2 * half)
+             - taps[0] * (frac * d1 * d2 * sixth)
+             - taps[2] * (dm1 * frac * d2 * half)
+             + taps[3] * (dm1 * frac * d1 * sixth);
+    }
+    void reset() {}
+};
+
+// First-order allpass: unity gain at every frequency, so it does not dull
+// feedback loops, but it has state. Each line must be read exactly once per
+// written sample (tap4() has its own four-lane state) and the delay should
+// move slowly: a jump rings for a few samples, longest when the fraction
+// is near zero.
+struct AllpassInterpolation {
+    static constexpr int kNewer = 0;
+    static constexpr int kTaps = 2;
+    static constexpr float kRounding = 0.0f;
+    static constexpr float kMinDelay = 1.0f;
+
+    float operator()(const float* taps, float frac) const {
+        const float eta = (1.0f - frac) / (1.0f + frac);
+        m_last = taps[1] + eta * (taps[0] - m_last);
+        return m_last;
+    }
+
+    simd::Float4 operator()(const simd::Float4* taps, simd::Float4 frac) const {
+        const simd::Float4 one = simd::Float4::broadcast(1.0f);
+        const simd::Float4 eta = (one - frac) / (one + frac);
+        m_last4 = taps[1] + eta * (taps[0] - m_last4);
+        return m_last4;
+    }
+
+    void reset() {
+        m_last = 0.0f;
+        m_last4 = simd::Float4::zero();
+    }
+
+private:
+    // Advanced by every read; the reads are const like every other policy's
+    mutable float m_last = 0.0f;
+    mutable simd::Float4 m_last4 = simd::Float4::zero();
+};
+
+} // namespace DeliVerb
@@ -1,15 +1,30 @@
 #pragma once
 
+#include "DelayInterpolation.h"
 #include <vector>
 #include <cmath>
 #include <algorithm>
+#include <span>
 
 namespace DeliVerb {
 
-// Circular buffer delay line with linear interpolation for sub-sample accuracy
-class DelayLine {
+// Circular buffer delay line; the Interpolation policy (DelayInterpolation.h)
+// sets how fractional delays are read, DelayLine is the linear one.
+// The buffer is rounded up to a power of two so wrapping is a mask. Callers
+// on the hot path convert their delay to samples once with delaySamples()
+// and read with tap(); read(ms) and readSamples() clamp on every call.
+// Block callers use writeBlock()/readBlock(), or segments() for raw access.
+template<typename Interpolation>
+class BasicDelayLine {
 public:
-    DelayLine() = default;
+    // A run of the buffer, oldest sample first, as at most two contiguous
+    // pieces: second is empty unless the run crosses the end of the buffer
+    struct Segments {
+        std::span<const float> first;
+        std::span<const float> second;
+    };
+
+    BasicDelayLine() = default;
 
     void setSampleRate(double sampleRate) {
         m_sampleRate = sampleRate;
@@ -18,89 +33,172 @@ public:
     // Allocate buffer for a maximum delay time in milliseconds
     void setMaxDelayMs(float maxDelayMs) {
         size_t maxSamples = static_cast<size_t>(m_sampleRate * maxDelayMs / 1000.0) + 4;
-        m_buffer.resize(maxSamples, 0.0f);
+        size_t size = 1;
+        while (size < maxSamples) size <<= 1;
+        m_buffer.assign(size, 0.0f);
+        m_mask = size - 1;
+        m_maxDelaySamples = static_cast<float>(maxSamples - 2);
         m_writeIndex = 0;
     }
 
     // Write a sample to the delay line
     void write(float sample) {
-        if (m_buffer.empty()) return;
+        if (m_mask == 0) return; // Not allocated yet
         m_buffer[m_writeIndex] = sample;
-        m_writeIndex++;
-        if (m_writeIndex >= m_buffer.size()) {
-            m_writeIndex = 0;
-        }
+        m_writeIndex = (m_writeIndex + 1) & m_mask;
     }
 
-    // Read from delay line with linear interpolation
-    // delayMs: delay time in milliseconds
-    float read(float delayMs) const {
-        if (m_buffer.empty()) return 0.0f;
+    // Same as numSamples calls to write(): one or two straight copies
+    void writeBlock(const float* input, int numSamples) {
+        if (m_mask == 0) return;
+        const size_t count = static_cast<size_t>(numSamples);
+        const size_t head = std::min(count, m_buffer.size() - m_writeIndex);
+        std::copy(input, input + head, m_buffer.begin() + m_writeIndex);
+        std::copy(input + head, input + count, m_buffer.begin());
+        m_writeIndex = (m_writeIndex + count) & m_mask;
+    }
 
-        // Convert ms to samples
-        float delaySamples = static_cast<float>(delayMs * m_sampleRate / 1000.0);
+    // Delay in milliseconds converted to samples and clamped to the range
+    // tap() accepts: at least Interpolation::kMinDelay (one sample, two for
+    // the four-point policies), at most the allocated maximum
+    float delaySamples(float delayMs) const {
+        return clampDelay(static_cast<float>(delayMs * m_sampleRate / 1000.0));
+    }
 
-        // Ensure minimum delay to avoid reading current write position
-        delaySamples = std::max(1.0f, delaySamples);
+    // Read with a delay already in [kMinDelay, maxDelaySamples()], e.g. from
+    // delaySamples(). No conversion, no clamping, no wrap branches.
+    float tap(float delaySamples) const {
+        size_t whole;
+        float frac;
+        split(delaySamples, whole, frac);
+        return interpolateAt((m_writeIndex - whole + kNewer) & m_mask, frac);
+    }
 
-        // Clamp to buffer size
-        delaySamples = std::min(delaySamples, static_cast<float>(m_buffer.size() - 2));
+    // Four taps at once, lane n at delaySamples[n]: the buffer reads are
+    // scalar gathers, the interpolation runs on all four lanes
+    simd::Float4 tap4(const float* delaySamples) const {
+        size_t newest[4];
+        float frac[4];
+        for (int lane = 0; lane < 4; ++lane) {
+            size_t whole;
+            split(delaySamples[lane], whole, frac[lane]);
+            newest[lane] = (m_writeIndex - whole + kNewer) & m_mask;
+        }
+        const float* buffer = m_buffer.data();
+        simd::Float4 taps[kTaps];
+        for (int k = 0; k < kTaps; ++k) {
+            taps[k] = simd::Float4::set(buffer[(newest[0] - k) & m_mask], buffer[(newest[1] - k) & m_mask],
+                                        buffer[(newest[2] - k) & m_mask], buffer[(newest[3] - k) & m_mask]);
+        }
+        return m_interpolation(taps, simd::Float4::set(frac[0], frac[1], frac[2], frac[3]));
+    }
 
-        // Calculate read position
-        float readPos = static_cast<float>(m_writeIndex) - delaySamples;
-        if (readPos < 0.0f) {
-            readPos += static_cast<float>(m_buffer.size());
+    // The block readers: output[i] is what tap() would return on sample i
+    // of a block that is then stored with writeBlock(). The block must not
+    // read its own input, so every delay must be at least numSamples
+    // (numSamples + 1 for the four-point policies).
+
+    // Fixed delay. Walks the buffer in contiguous runs, so the inner loop
+    // has no index arithmetic and vectorizes.
+    void readBlock(float* output, int numSamples, float delaySamples) const {
+        size_t whole;
+        float frac;
+        split(delaySamples, whole, frac);
+        const float* buffer = m_buffer.data();
+        for (int done = 0; done < numSamples;) {
+            const size_t newest = (m_writeIndex + static_cast<size_t>(done) - whole + kNewer) & m_mask;
+            if (newest < static_cast<size_t>(kTaps - 1)) {
+                // The older taps wrap to the end of the buffer
+                output[done++] = interpolateAt(newest, frac);
+                continue;
+            }
+            const int run = static_cast<int>(std::min<size_t>(numSamples - done, m_buffer.size() - newest));
+            const float* window = buffer + newest;
+            float* out = output + done;
+            for (int i = 0; i < run; ++i) {
+                float taps[kTaps];
+                for (int k = 0; k < kTaps; ++k) taps[k] = window[i - k];
+                out[i] = m_interpolation(taps, frac);
+            }
+            done += run;
         }
+    }
 
-        // Linear interpolation
-        size_t index0 = static_cast<size_t>(readPos);
-        size_t index1 = index0 + 1;
-        if (index1 >= m_buffer.size()) {
-            index1 = 0;
+    // Per-sample delay, e.g. modulated; delaySamples[i] as tap() expects
+    void readBlock(float* output, int numSamples, const float* delaySamples) const {
+        for (int i = 0; i < numSamples; ++i) {
+            size_t whole;
+            float frac;
+            split(delaySamples[i], whole, frac);
+            output[i] = interpolateAt((m_writeIndex + static_cast<size_t>(i) - whole + kNewer) & m_mask, frac);
         }
+    }
 
-        float frac = readPos - static_cast<float>(index0);
-        return m_buffer[index0] * (1.0f - frac) + m_buffer[index1] * frac;
+    // The numSamples samples written delay..delay-numSamples+1 writes ago,
+    // oldest first; numSamples <= delay <= maxDelaySamples()
+    Segments segments(size_t delay, int numSamples) const {
+        const size_t start = (m_writeIndex - delay) & m_mask;
+        const size_t count = static_cast<size_t>(numSamples);
+        const size_t head = std::min(count, m_buffer.size() - start);
+        return {{m_buffer.data() + start, head}, {m_buffer.data(), count - head}};
+    }
+
+    // Read from delay line with interpolation
+    // delayMs: delay time in milliseconds
+    float read(float delayMs) const {
+        return tap(delaySamples(delayMs));
     }
 
     // Read from delay line in samples (for tempo-synced delays)
     float readSamples(float delaySamples) const {
-        if (m_buffer.empty()) return 0.0f;
-
-        // Ensure minimum delay
-        delaySamples = std::max(1.0f, delaySamples);
-
-        // Clamp to buffer size
-        delaySamples = std::min(delaySamples, static_cast<float>(m_buffer.size() - 2));
-
-        // Calculate read position
-        float readPos = static_cast<float>(m_writeIndex) - delaySamples;
-        if (readPos < 0.0f) {
-            readPos += static_cast<float>(m_buffer.size());
-        }
-
-        // Linear interpolation
-        size_t index0 = static_cast<size_t>(readPos);
-        size_t index1 = index0 + 1;
-        if (index1 >= m_buffer.size()) {
-            index1 = 0;
-        }
-
-        float frac = readPos - static_cast<float>(index0);
-        return m_buffer[index0] * (1.0f - frac) + m_buffer[index1] * frac;
+        return tap(clampDelay(delaySamples));
     }
 
     void reset() {
         std::fill(m_buffer.begin(), m_buffer.end(), 0.0f);
         m_writeIndex = 0;
+        m_interpolation.reset();
     }
 
     double getSampleRate() const { return m_sampleRate; }
 
+    // Longest delay tap() may be given
+    float maxDelaySamples() const { return m_maxDelaySamples; }
+
+    // Heap memory held by the buffer
+    size_t memoryBytes() const { return m_buffer.capacity() * sizeof(float); }
+
 private:
+    static constexpr int kTaps = Interpolation::kTaps;
+    static constexpr size_t kNewer = Interpolation::kNewer;
+
+    float clampDelay(float delaySamples) const {
+        // Ensure minimum delay to avoid reading current write position
+        return std::min(std::max(Interpolation::kMinDelay, delaySamples), m_maxDelaySamples);
+    }
+
+    static void split(float delaySamples, size_t& whole, float& frac) {
+        if constexpr (Interpolation::kRounding != 0.0f) delaySamples += Interpolation::kRounding;
+        whole = static_cast<size_t>(delaySamples);
+        frac = delaySamples - static_cast<float>(whole);
+    }
+
+    // newest: buffer index of taps[0]
+    float interpolateAt(size_t newest, float frac) const {
+        float taps[kTaps];
+        for (int k = 0; k < kTaps; ++k) taps[k] = m_buffer[(newest - k) & m_mask];
+        return m_interpolation(taps, frac);
+    }
+
     double m_sampleRate = 44100.0;
-    std::vector<float> m_buffer;
+    // Until setMaxDelayMs() a single silent sample, so tap() is always safe
+    std::vector<float> m_buffer = std::vector<float>(1, 0.0f);
+    size_t m_mask = 0;
     size_t m_writeIndex = 0;
+    float m_maxDelaySamples = 1.0f;
+    Interpolation m_interpolation;
 };
 
+using DelayLine = BasicDelayLine<LinearInterpolation>;
+
 } // namespace DeliVerb
@@ -4,8 +4,16 @@
 #include "Reverb.h"
 #include "Ducker.h"
 #include "Biquad.h"
+#include "Denormals.h"
+#include "ParameterStore.h"
+#include "Profiler.h"
+#include "RenderMonitor.h"
+#include "SmootherBank.h"
+#include "TripleBuffer.h"
 #include <cmath>
 #include <algorithm>
+#include <atomic>
+#include <cstdint>
 
 namespace DeliVerb {
 
@@ -47,6 +55,12 @@ public:
 
     DeliVerbDSP() {
         setDefaultParameters();
+        for (int p = 0; p < kNumParams; ++p) {
+            m_parameters.set(p, renderParameter(static_cast<ParamID>(p)));
+        }
+        configureSmoothers();
+        snapSmoothers();
+        publishCoefficients();
     }
 
     void setSampleRate(double sampleRate) {
@@ -64,24 +78,250 @@ public:
         // Configure ducker
         m_ducker.setSampleRate(sampleRate);
 
-        // Configure delay filters
-        m_delayLowCutL.setSampleRate(sampleRate);
-        m_delayLowCutR.setSampleRate(sampleRate);
-        m_delayHighCutL.setSampleRate(sampleRate);
-        m_delayHighCutR.setSampleRate(sampleRate);
-        m_delayScoopL.setSampleRate(sampleRate);
-        m_delayScoopR.setSampleRate(sampleRate);
+        m_renderMonitor.setSampleRate(sampleRate);
 
         // Anti-aliasing filter for delay feedback
-        m_delayFeedbackFilterL.setSampleRate(sampleRate);
-        m_delayFeedbackFilterR.setSampleRate(sampleRate);
-        m_delayFeedbackFilterL.setCoefficients(Biquad::Type::LowPass, 12000.0, 0.707);
-        m_delayFeedbackFilterR.setCoefficients(Biquad::Type::LowPass, 12000.0, 0.707);
+        m_delayFeedbackFilter.setCoefficients(Biquad::design(Biquad::Type::LowPass, 12000.0, 0.707, 0.0, sampleRate));
+
+        // Every coefficient depends on the sample rate; rebuild and adopt
+        // the set now, nothing is rendering
+        m_controlSampleRate.store(sampleRate, std::memory_order_release);
+        publishCoefficients();
+        takeCoefficients(0);
 
-        updateParameters();
+        configureSmoothers();
+        snapSmoothers();
     }
 
+    // Control threads (host, UI). Recomputes the coefficients that depend on
+    // the parameter on the calling thread and publishes them; the render
+    // thread adopts the new set at the start of its next block. Never blocks:
+    // if another thread is already building, that thread picks this change up.
+    // Unchanged values cost nothing, so hosts may re-send every parameter.
+    // Calling this from the render thread works but puts the coefficient math
+    // back inside the render budget.
     void setParameter(ParamID param, float value) {
+        if (param < 0 || param >= kNumParams || m_parameters.get(param) == value) return;
+        m_parameters.set(param, value);
+        publishCoefficients();
+    }
+
+    // Any thread; the most recently set value
+    float getParameter(ParamID param) const {
+        if (param < 0 || param >= kNumParams) return 0.0f;
+        const float value = m_parameters.get(param);
+        if (param == kAdvanced) return value > 0.5f ? 1.0f : 0.0f;
+        return value;
+    }
+
+    // Stereo processing
+    void processStereo(const float* inputL, const float* inputR,
+                       float* outputL, float* outputR, int numSamples) {
+        const auto renderStart = RenderMonitor::Clock::now();
+        DELIVERB_PROFILE_BLOCK("processStereo", numSamples);
+        ScopedNoDenormals noDenormals;
+        takeCoefficients(numSamples);
+        DELIVERB_PROFILE_STAGE(ProfileStage::ParameterUpdate);
+
+        // Per sub-block: delay output (wet after ducking), reverb send then
+        // reverb output (in place), reverb ducking gain
+        alignas(16) float delayedL[kMaxRenderBlock];
+        alignas(16) float delayedR[kMaxRenderBlock];
+        alignas(16) float reverbL[kMaxRenderBlock];
+        alignas(16) float reverbR[kMaxRenderBlock];
+        alignas(16) float reverbGain[kMaxRenderBlock];
+
+        for (int i = 0; i < numSamples;) {
+            const int end = beginSmoothingBlock(i, numSamples);
+            const float delayTime = m_smoothers.value(kSmoothDelayTime);
+            const float delayRepeat = m_smoothers.value(kSmoothDelayRepeat);
+            const float delayMix = m_smoothers.value(kSmoothDelayMix);
+            const float reverbStyle = m_smoothers.value(kSmoothReverbStyle);
+            const float reverbMix = m_smoothers.value(kSmoothReverbMix);
+            glideDelayTaps(delayTime);
+            DELIVERB_PROFILE_STAGE(ProfileStage::ParameterUpdate);
+
+            // ==================== DELAY PROCESSING ====================
+            processDelayBlock(inputL + i, inputR + i, delayedL, delayedR, end - i, delayRepeat);
+
+            // Ducking gains and the reverb send
+            const int count = end - i;
+            for (int j = 0; j < count; ++j) {
+                float dryL = inputL[i + j];
+                float dryR = inputR[i + j];
+
+                // Calculate ducking gains based on input
+                float delayGain;
+                m_ducker.process(dryL, dryR, delayGain, reverbGain[j]);
+
+                // Apply ducking to delay
+                delayedL[j] *= delayGain;
+                delayedR[j] *= delayGain;
+
+                // Style-based routing: Atmospheric styles add some delay output to reverb
+                reverbL[j] = dryL;
+                reverbR[j] = dryR;
+                if (reverbStyle > 0.3f) {
+                    float delayToReverb = (reverbStyle - 0.3f) / 0.7f * 0.3f;
+                    reverbL[j] += delayedL[j] * delayToReverb;
+                    reverbR[j] += delayedR[j] * delayToReverb;
+                }
+            }
+            DELIVERB_PROFILE_STAGE(ProfileStage::Ducker);
+
+            // ==================== REVERB PROCESSING ====================
+            m_reverb.processBlock(reverbL, reverbR, reverbL, reverbR, count);
+
+            // ==================== MIXING ====================
+            float* outL = outputL + i;
+            float* outR = outputR + i;
+            for (int j = 0; j < count; ++j) {
+                float dryL = inputL[i + j];
+                float dryR = inputR[i + j];
+
+                // Apply ducking to reverb
+                float reverbWetL = reverbL[j] * reverbGain[j];
+                float reverbWetR = reverbR[j] * reverbGain[j];
+
+                // Mix delay
+                float withDelayL = dryL + delayedL[j] * delayMix;
+                float withDelayR = dryR + delayedR[j] * delayMix;
+
+                // Mix reverb
+                outL[j] = withDelayL * (1.0f - reverbMix) + (withDelayL + reverbWetL) * reverbMix;
+                outR[j] = withDelayR * (1.0f - reverbMix) + (withDelayR + reverbWetR) * reverbMix;
+            }
+            DELIVERB_PROFILE_STAGE(ProfileStage::Mixing);
+
+            // Apply subtle output limiting to prevent clipping
+            for (int j = 0; j < count; ++j) {
+                outL[j] = std::tanh(outL[j] * 0.9f) / 0.9f;
+                outR[j] = std::tanh(outR[j] * 0.9f) / 0.9f;
+            }
+            DELIVERB_PROFILE_STAGE(ProfileStage::Limiter);
+            i += count;
+        }
+
+        recordRenderTime(renderStart, numSamples);
+    }
+
+    // Mono input, stereo output
+    void process(const float* input, float* outputL, float* outputR, int numSamples) {
+        const auto renderStart = RenderMonitor::Clock::now();
+        DELIVERB_PROFILE_BLOCK("process", numSamples);
+        ScopedNoDenormals noDenormals;
+        takeCoefficients(numSamples);
+        DELIVERB_PROFILE_STAGE(ProfileStage::ParameterUpdate);
+
+        // Per sub-block: delay output (wet after ducking), reverb send then
+        // reverb output (in place), reverb ducking gain
+        alignas(16) float delayedL[kMaxRenderBlock];
+        alignas(16) float delayedR[kMaxRenderBlock];
+        alignas(16) float reverbL[kMaxRenderBlock];
+        alignas(16) float reverbR[kMaxRenderBlock];
+        alignas(16) float reverbGain[kMaxRenderBlock];
+
+        for (int i = 0; i < numSamples;) {
+            const int end = beginSmoothingBlock(i, numSamples);
+            const float delayTime = m_smoothers.value(kSmoothDelayTime);
+            const float delayRepeat = m_smoothers.value(kSmoothDelayRepeat);
+            const float delayMix = m_smoothers.value(kSmoothDelayMix);
+            const float reverbStyle = m_smoothers.value(kSmoothReverbStyle);
+            const float reverbMix = m_smoothers.value(kSmoothReverbMix);
+            glideDelayTaps(delayTime);
+            DELIVERB_PROFILE_STAGE(ProfileStage::ParameterUpdate);
+
+            // ==================== DELAY PROCESSING ====================
+            processDelayBlock(input + i, input + i, delayedL, delayedR, end - i, delayRepeat);
+
+            // Ducking gains and the reverb send
+            const int count = end - i;
+            for (int j = 0; j < count; ++j) {
+                float dry = input[i + j];
+
+                // Calculate ducking gains
+                float delayGain;
+                m_ducker.process(dry, dry, delayGain, reverbGain[j]);
+
+                // Apply ducking
+                delayedL[j] *= delayGain;
+                delayedR[j] *= delayGain;
+
+                reverbL[j] = dry;
+                reverbR[j] = dry;
+                if (reverbStyle > 0.3f) {
+                    float delayToReverb = (reverbStyle - 0.3f) / 0.7f * 0.3f;
+                    reverbL[j] += delayedL[j] * delayToReverb;
+                    reverbR[j] += delayedR[j] * delayToReverb;
+                }
+            }
+            DELIVERB_PROFILE_STAGE(ProfileStage::Ducker);
+
+            // ==================== REVERB PROCESSING ====================
+            m_reverb.processBlock(reverbL, reverbR, reverbL, reverbR, count);
+
+            // ==================== MIXING ====================
+            float* outL = outputL + i;
+            float* outR = outputR + i;
+            for (int j = 0; j < count; ++j) {
+                float dry = input[i + j];
+
+                float reverbWetL = reverbL[j] * reverbGain[j];
+                float reverbWetR = reverbR[j] * reverbGain[j];
+
+                float withDelayL = dry + delayedL[j] * delayMix;
+                float withDelayR = dry + delayedR[j] * delayMix;
+
+                outL[j] = withDelayL * (1.0f - reverbMix) + (withDelayL + reverbWetL) * reverbMix;
+                outR[j] = withDelayR * (1.0f - reverbMix) + (withDelayR + reverbWetR) * reverbMix;
+            }
+            DELIVERB_PROFILE_STAGE(ProfileStage::Mixing);
+
+            for (int j = 0; j < count; ++j) {
+                outL[j] = std::tanh(outL[j] * 0.9f) / 0.9f;
+                outR[j] = std::tanh(outR[j] * 0.9f) / 0.9f;
+            }
+            DELIVERB_PROFILE_STAGE(ProfileStage::Limiter);
+            i += count;
+        }
+
+        recordRenderTime(renderStart, numSamples);
+    }
+
+    // Per-block timing statistics, readable from any thread
+    const RenderMonitor& renderMonitor() const { return m_renderMonitor; }
+    RenderMonitor& renderMonitor() { return m_renderMonitor; }
+
+    // Heap memory held by the delay and reverb buffers at the current sample rate
+    size_t memoryBytes() const {
+        return m_delayL.memoryBytes() + m_delayR.memoryBytes() + m_reverb.memoryBytes();
+    }
+
+    // Clears all state and jumps straight to the latest parameters (there is
+    // no previous sound to glide from)
+    void reset() {
+        takeCoefficients(0);
+        m_reverb.finishRamp();
+        m_delayTone.finishRamp();
+        snapSmoothers();
+
+        m_delayL.reset();
+        m_delayR.reset();
+        m_reverb.reset();
+        m_ducker.reset();
+        m_delayTone.reset();
+        m_delayFeedbackFilter.reset();
+    }
+
+private:
+    void recordRenderTime(RenderMonitor::Clock::time_point start, int numSamples) {
+        m_renderMonitor.recordBlock(start, numSamples, kNumParams, [this](int param) {
+            return renderParameter(static_cast<ParamID>(param));
+        });
+    }
+
+    // Render thread: copies a published value into the render-side state
+    void setRenderParameter(ParamID param, float value) {
         switch (param) {
             case kDelayTime:        m_delayTime = value; break;
             case kDelayRepeat:      m_delayRepeat = value; break;
@@ -101,10 +341,10 @@ public:
             case kAdvanced:         m_advanced = value > 0.5f; break;
             default: break;
         }
-        updateParameters();
     }
 
-    float getParameter(ParamID param) const {
+    // Render thread: the value the engine is currently running with
+    float renderParameter(ParamID param) const {
         switch (param) {
             case kDelayTime:        return m_delayTime;
             case kDelayRepeat:      return m_delayRepeat;
@@ -126,199 +366,335 @@ public:
         }
     }
 
-    // Stereo processing
-    void processStereo(const float* inputL, const float* inputR,
-                       float* outputL, float* outputR, int numSamples) {
-        for (int i = 0; i < numSamples; ++i) {
-            float dryL = inputL[i];
-            float dryR = inputR[i];
+    void setDefaultParameters() {
+        m_delayTime = 300.0f;      // 300ms delay
+        m_delayRepeat = 0.3f;      // 30% feedback
+        m_delayMix = 0.3f;         // 30% wet
 
-            // Calculate ducking gains based on input
-            float delayGain, reverbGain;
-            m_ducker.process(dryL, dryR, delayGain, reverbGain);
+        m_reverbSize = 0.5f;       // Medium room
+        m_reverbStyle = 0.0f;      // Classic
+        m_reverbMix = 0.3f;        // 30% wet
 
-            // ==================== DELAY PROCESSING ====================
-            // Read from delay lines
-            float delayedL = m_delayL.read(m_delayTime);
-            float delayedR = m_delayR.read(m_delayTime + 2.0f); // Slight stereo offset
-
-            // Apply delay filters
-            delayedL = m_delayLowCutL.process(delayedL);
-            delayedL = m_delayHighCutL.process(delayedL);
-            delayedL = m_delayScoopL.process(delayedL);
-            delayedR = m_delayLowCutR.process(delayedR);
-            delayedR = m_delayHighCutR.process(delayedR);
-            delayedR = m_delayScoopR.process(delayedR);
-
-            // Apply ducking to delay
-            float delayWetL = delayedL * delayGain;
-            float delayWetR = delayedR * delayGain;
-
-            // Write to delay lines with feedback
-            float feedbackL = m_delayFeedbackFilterL.process(delayedL) * m_delayRepeat;
-            float feedbackR = m_delayFeedbackFilterR.process(delayedR) * m_delayRepeat;
-            m_delayL.write(dryL + feedbackL);
-            m_delayR.write(dryR + feedbackR);
+        m_delayLowCut = 80.0f;
+        m_delayHighCut = 8000.0f;
+        m_delayScoopAmount = 0.0f;
+        m_reverbLowCut = 100.0f;
+        m_reverbHighCut = 10000.0f;
+        m_reverbScoopAmount = 0.0f;
 
-            // ==================== REVERB PROCESSING ====================
-            float reverbInL = dryL;
-            float reverbInR = dryR;
-
-            // Style-based routing: Atmospheric styles add some delay output to reverb
-            if (m_reverbStyle > 0.3f) {
-                float delayToReverb = (m_reverbStyle - 0.3f) / 0.7f * 0.3f;
-                reverbInL += delayWetL * delayToReverb;
-                reverbInR += delayWetR * delayToReverb;
-            }
+        m_duckDelayAmount = 0.0f;
+        m_duckReverbAmount = 0.0f;
+        m_duckBehaviour = 0.5f;
 
-            float reverbWetL, reverbWetR;
-            m_reverb.process(reverbInL, reverbInR, reverbWetL, reverbWetR);
+        m_advanced = false;
+    }
 
-            // Apply ducking to reverb
-            reverbWetL *= reverbGain;
-            reverbWetR *= reverbGain;
+    // Derived state, one bit per group of coefficients recomputed together
+    static constexpr int kNumDirtyGroups = 8;
+    enum DirtyFlag : uint32_t {
+        kDirtyReverbSize     = 1u << 0,  // Allpass/comb delay times, comb feedback
+        kDirtyReverbStyle    = 1u << 1,  // Diffusion, 16 comb damping filters, spread
+        kDirtyReverbLowCut   = 1u << 2,
+        kDirtyReverbHighCut  = 1u << 3,
+        kDirtyReverbScoop    = 1u << 4,
+        kDirtyDelayLowCut    = 1u << 5,
+        kDirtyDelayHighCut   = 1u << 6,
+        kDirtyDelayScoop     = 1u << 7,
+        kDirtyAll            = (1u << kNumDirtyGroups) - 1,
+        kDirtyReverb         = kDirtyReverbSize | kDirtyReverbStyle | kDirtyReverbLowCut |
+                               kDirtyReverbHighCut | kDirtyReverbScoop
+    };
 
-            // ==================== MIXING ====================
-            // Mix delay
-            float withDelayL = dryL + delayWetL * m_delayMix;
-            float withDelayR = dryR + delayWetR * m_delayMix;
+    // Dependency graph: the derived state each ParamID feeds. Parameters the
+    // render thread uses directly (times, mixes, repeat, ducking) have none.
+    static constexpr uint32_t kParamDependencies[kNumParams] = {
+        0,                    // kDelayTime
+        0,                    // kDelayRepeat
+        0,                    // kDelayMix
+        kDirtyReverbSize,     // kReverbSize
+        kDirtyReverbStyle,    // kReverbStyle
+        0,                    // kReverbMix
+        kDirtyDelayLowCut,    // kDelayLowCut
+        kDirtyDelayHighCut,   // kDelayHighCut
+        kDirtyDelayScoop,     // kDelayScoopAmount
+        kDirtyReverbLowCut,   // kReverbLowCut
+        kDirtyReverbHighCut,  // kReverbHighCut
+        kDirtyReverbScoop,    // kReverbScoopAmount
+        0,                    // kDuckDelayAmount
+        0,                    // kDuckReverbAmount
+        0,                    // kDuckBehaviour
+        0,                    // kAdvanced
+    };
 
-            // Mix reverb
-            outputL[i] = withDelayL * (1.0f - m_reverbMix) + (withDelayL + reverbWetL) * m_reverbMix;
-            outputR[i] = withDelayR * (1.0f - m_reverbMix) + (withDelayR + reverbWetR) * m_reverbMix;
+    // Everything the render thread needs from the parameters, built off the
+    // audio thread and handed over as a unit
+    struct CoefficientSet {
+        float params[kNumParams] = {};
+        Reverb::Coefficients reverb;
+        Biquad::Coefficients delayLowCut;
+        Biquad::Coefficients delayHighCut;
+        Biquad::Coefficients delayScoop;
+        // Bumped each time a group is recomputed. The render thread compares
+        // them with the set it adopted last, so it sees every group that
+        // changed even when it skipped sets published in between.
+        uint32_t versions[kNumDirtyGroups] = {};
+    };
 
-            // Apply subtle output limiting to prevent clipping
-            outputL[i] = std::tanh(outputL[i] * 0.9f) / 0.9f;
-            outputR[i] = std::tanh(outputR[i] * 0.9f) / 0.9f;
+    // Control side: folds pending parameter changes into the working set,
+    // recomputing only the dirty groups, and publishes a copy. One thread
+    // builds at a time; a caller that finds the builder busy leaves a request
+    // that the builder honours before it lets go (so no change is dropped).
+    void publishCoefficients() {
+        m_buildRequested.store(true);
+        while (m_buildRequested.load() && !m_building.exchange(true)) {
+            m_buildRequested.store(false);
+            buildCoefficients();
+            m_building.store(false);
         }
     }
 
-    // Mono input, stereo output
-    void process(const float* input, float* outputL, float* outputR, int numSamples) {
-        for (int i = 0; i < numSamples; ++i) {
-            float dry = input[i];
+    void buildCoefficients() {
+        CoefficientSet& set = m_buildSet;
+        uint32_t dirty = 0;
+        bool changed = false;
 
-            // Calculate ducking gains
-            float delayGain, reverbGain;
-            m_ducker.process(dry, dry, delayGain, reverbGain);
+        const double sampleRate = m_controlSampleRate.load(std::memory_order_acquire);
+        if (sampleRate != m_builtSampleRate) {
+            m_builtSampleRate = sampleRate;
+            dirty = kDirtyAll;
+        }
+        m_parameters.consume([&](int param, float value) {
+            if (set.params[param] == value) return;
+            set.params[param] = value;
+            dirty |= kParamDependencies[param];
+            changed = true;
+        });
+        if (!changed && dirty == 0) return;
+
+        // Reverb
+        if (dirty & kDirtyReverbSize)    Reverb::computeSize(set.reverb, set.params[kReverbSize]);
+        if (dirty & kDirtyReverbStyle)   Reverb::computeStyle(set.reverb, set.params[kReverbStyle], sampleRate);
+        if (dirty & kDirtyReverbLowCut)  Reverb::computeLowCut(set.reverb, set.params[kReverbLowCut], sampleRate);
+        if (dirty & kDirtyReverbHighCut) Reverb::computeHighCut(set.reverb, set.params[kReverbHighCut], sampleRate);
+        if (dirty & kDirtyReverbScoop)   Reverb::computeScoop(set.reverb, set.params[kReverbScoopAmount], sampleRate);
+
+        // Delay filters
+        if (dirty & kDirtyDelayLowCut) {
+            set.delayLowCut = Biquad::design(Biquad::Type::HighPass, set.params[kDelayLowCut], 0.707, 0.0, sampleRate);
+        }
+        if (dirty & kDirtyDelayHighCut) {
+            set.delayHighCut = Biquad::design(Biquad::Type::LowPass, set.params[kDelayHighCut], 0.707, 0.0, sampleRate);
+        }
+        if (dirty & kDirtyDelayScoop) {
+            // Delay scoop filter (500Hz center, -12dB max cut)
+            float delayScoopGain = set.params[kDelayScoopAmount] * -12.0f;
+            set.delayScoop = Biquad::design(Biquad::Type::Peak, 500.0, 0.7, delayScoopGain, sampleRate);
+        }
 
-            // ==================== DELAY PROCESSING ====================
-            float delayedL = m_delayL.read(m_delayTime);
-            float delayedR = m_delayR.read(m_delayTime + 2.0f);
-
-            // Apply delay filters
-            delayedL = m_delayLowCutL.process(delayedL);
-            delayedL = m_delayHighCutL.process(delayedL);
-            delayedL = m_delayScoopL.process(delayedL);
-            delayedR = m_delayLowCutR.process(delayedR);
-            delayedR = m_delayHighCutR.process(delayedR);
-            delayedR = m_delayScoopR.process(delayedR);
-
-            // Apply ducking
-            float delayWetL = delayedL * delayGain;
-            float delayWetR = delayedR * delayGain;
-
-            // Feedback
-            float feedbackL = m_delayFeedbackFilterL.process(delayedL) * m_delayRepeat;
-            float feedbackR = m_delayFeedbackFilterR.process(delayedR) * m_delayRepeat;
-            m_delayL.write(dry + feedbackL);
-            m_delayR.write(dry + feedbackR);
+        for (int g = 0; g < kNumDirtyGroups; ++g) {
+            if (dirty & (1u << g)) ++set.versions[g];
+        }
 
-            // ==================== REVERB PROCESSING ====================
-            float reverbInL = dry;
-            float reverbInR = dry;
+        m_coefficients.back() = set;
+        m_coefficients.publish();
+    }
+
+    // Render thread, at block boundaries: adopts the latest published set.
+    // Only copies; the expensive math already happened in buildCoefficients().
+    // Filter coefficients and reverb delay times glide to the new set across
+    // rampSamples (the block about to be rendered); 0 switches immediately.
+    // Only groups that changed are ramped: a pending reverb ramp sends the
+    // reverb down its per-sample path, and a ramp wakes a drained unity stage.
+    void takeCoefficients(int rampSamples) {
+        if (!m_coefficients.update()) return;
+        const CoefficientSet& set = m_coefficients.front();
+
+        for (int p = 0; p < kNumParams; ++p) {
+            setRenderParameter(static_cast<ParamID>(p), set.params[p]);
+        }
+
+        uint32_t changed = 0;
+        for (int g = 0; g < kNumDirtyGroups; ++g) {
+            if (set.versions[g] != m_adoptedVersions[g]) changed |= 1u << g;
+            m_adoptedVersions[g] = set.versions[g];
+        }
 
-            if (m_reverbStyle > 0.3f) {
-                float delayToReverb = (m_reverbStyle - 0.3f) / 0.7f * 0.3f;
-                reverbInL += delayWetL * delayToReverb;
-                reverbInR += delayWetR * delayToReverb;
+        if (changed & kDirtyReverb) m_reverb.rampTo(set.reverb, rampSamples);
+
+        if (changed & kDirtyDelayLowCut) m_delayTone.rampTo(kToneLowCut, set.delayLowCut, rampSamples);
+        if (changed & kDirtyDelayHighCut) m_delayTone.rampTo(kToneHighCut, set.delayHighCut, rampSamples);
+        if (changed & kDirtyDelayScoop) m_delayTone.rampTo(kToneScoop, set.delayScoop, rampSamples);
+
+        // Mixes, repeat, delay time and ducking glide in the smoother bank
+        if (rampSamples == 0) {
+            snapSmoothers();
+        } else {
+            for (int k = 0; k < kNumSmoothed; ++k) {
+                m_smoothers.setTarget(k, renderParameter(kSmoothedParams[k]));
             }
+        }
+    }
 
-            float reverbWetL, reverbWetR;
-            m_reverb.process(reverbInL, reverbInR, reverbWetL, reverbWetR);
+    // Parameters the render loop reads directly, smoothed in one bank. Filter
+    // cutoffs, size and style's filters already glide through the coefficient
+    // ramps in takeCoefficients(); style is here for the delay-to-reverb send.
+    enum SmoothedParam {
+        kSmoothDelayTime = 0,
+        kSmoothDelayRepeat,
+        kSmoothDelayMix,
+        kSmoothReverbStyle,
+        kSmoothReverbMix,
+        kSmoothDuckDelay,
+        kSmoothDuckReverb,
+        kSmoothDuckBehaviour,
+        kNumSmoothed
+    };
 
-            reverbWetL *= reverbGain;
-            reverbWetR *= reverbGain;
+    static constexpr ParamID kSmoothedParams[kNumSmoothed] = {
+        kDelayTime, kDelayRepeat, kDelayMix, kReverbStyle, kReverbMix,
+        kDuckDelayAmount, kDuckReverbAmount, kDuckBehaviour
+    };
 
-            // ==================== MIXING ====================
-            float withDelayL = dry + delayWetL * m_delayMix;
-            float withDelayR = dry + delayWetR * m_delayMix;
+    // Samples between smoother steps
+    static constexpr int kSmoothingBlock = 16;
 
-            outputL[i] = withDelayL * (1.0f - m_reverbMix) + (withDelayL + reverbWetL) * m_reverbMix;
-            outputR[i] = withDelayR * (1.0f - m_reverbMix) + (withDelayR + reverbWetR) * m_reverbMix;
+    // Longest render sub-block, used once the smoothers have settled; sizes
+    // the delay section's scratch buffers
+    static constexpr int kMaxRenderBlock = 256;
 
-            outputL[i] = std::tanh(outputL[i] * 0.9f) / 0.9f;
-            outputR[i] = std::tanh(outputR[i] * 0.9f) / 0.9f;
+    void configureSmoothers() {
+        for (int k = 0; k < kNumSmoothed; ++k) {
+            m_smoothers.setTimeConstant(k, 10.0f, m_sampleRate, kSmoothingBlock);
+            m_smoothers.setTolerance(k, 1.0e-5f);
         }
+        // Slower glide for delay time so changes bend pitch rather than click;
+        // glideDelayTaps() spreads each step across the samples to the next
+        m_smoothers.setTimeConstant(kSmoothDelayTime, 50.0f, m_sampleRate, kSmoothingBlock);
+        m_smoothers.setTolerance(kSmoothDelayTime, 1.0e-3f);
     }
 
-    void reset() {
-        m_delayL.reset();
-        m_delayR.reset();
-        m_reverb.reset();
-        m_ducker.reset();
-        m_delayLowCutL.reset();
-        m_delayLowCutR.reset();
-        m_delayHighCutL.reset();
-        m_delayHighCutR.reset();
-        m_delayScoopL.reset();
-        m_delayScoopR.reset();
-        m_delayFeedbackFilterL.reset();
-        m_delayFeedbackFilterR.reset();
+    // Jumps the smoothers to the current render-side values
+    void snapSmoothers() {
+        for (int k = 0; k < kNumSmoothed; ++k) {
+            m_smoothers.setTarget(k, renderParameter(kSmoothedParams[k]));
+        }
+        m_smoothers.snap();
+        m_smoothingCountdown = 0;
+        applySmoothedDucking();
+
+        const float delayTime = m_smoothers.value(kSmoothDelayTime);
+        m_delayTapL.snap(m_delayL.delaySamples(delayTime));
+        m_delayTapR.snap(m_delayR.delaySamples(delayTime + 2.0f));
+        m_delayGlideRemaining = 0;
     }
 
-private:
-    void setDefaultParameters() {
-        m_delayTime = 300.0f;      // 300ms delay
-        m_delayRepeat = 0.3f;      // 30% feedback
-        m_delayMix = 0.3f;         // 30% wet
+    // The delay time smoother steps once per kSmoothingBlock. Reading each
+    // step's tap for a whole sub-block would jump the read point by up to
+    // hundreds of samples every step, a click per step; instead the taps move
+    // linearly from where they are to the new value over the next
+    // kSmoothingBlock samples, which is when the following step lands.
+    void glideDelayTaps(float delayTime) {
+        const float targetL = m_delayL.delaySamples(delayTime);
+        const float targetR = m_delayR.delaySamples(delayTime + 2.0f); // Slight stereo offset
+        if (targetL == m_delayTapL.target && targetR == m_delayTapR.target) return;
+        m_delayTapL.glideTo(targetL);
+        m_delayTapR.glideTo(targetR);
+        m_delayGlideRemaining = kSmoothingBlock;
+    }
 
-        m_reverbSize = 0.5f;       // Medium room
-        m_reverbStyle = 0.0f;      // Classic
-        m_reverbMix = 0.3f;        // 30% wet
+    // Starts the sub-block at sample i and returns where it ends. The smoothers
+    // step every kSmoothingBlock samples on a grid that carries across calls,
+    // so glide times don't depend on the host's block size. Once they have
+    // settled they stay settled until the next block's takeCoefficients(),
+    // so the sub-block runs up to kMaxRenderBlock samples and the grid
+    // restarts with the next glide, on the first sample of its block.
+    int beginSmoothingBlock(int i, int numSamples) {
+        if (m_smoothingCountdown == 0) {
+            if (m_smoothers.advance()) applySmoothedDucking();
+            m_smoothingCountdown = kSmoothingBlock;
+        }
+        if (m_smoothers.isSettled()) {
+            const int end = std::min(numSamples, i + kMaxRenderBlock);
+            m_smoothingCountdown = 0;
+            return end;
+        }
+        const int end = std::min(numSamples, i + m_smoothingCountdown);
+        m_smoothingCountdown -= end - i;
+        return end;
+    }
 
-        m_delayLowCut = 80.0f;
-        m_delayHighCut = 8000.0f;
-        m_delayScoopAmount = 0.0f;
-        m_reverbLowCut = 100.0f;
-        m_reverbHighCut = 10000.0f;
-        m_reverbScoopAmount = 0.0f;
+    // The delay section for numSamples samples as block passes: read both
+    // lines, run the tone stack into delayedL/R (the wet signal before
+    // ducking), filter the feedback and write dry plus feedback back. A
+    // sample written here is first read a whole delay later, so passes over
+    // chunks no longer than the delay give exactly the per-sample result;
+    // with the 50 ms minimum delay time that is one chunk, or one per
+    // gliding stretch while the taps move.
+    void processDelayBlock(const float* dryL, const float* dryR, float* delayedL, float* delayedR,
+                           int numSamples, float delayRepeat) {
+        alignas(16) float feedbackL[kMaxRenderBlock];
+        alignas(16) float feedbackR[kMaxRenderBlock];
+
+        for (int start = 0; start < numSamples;) {
+            // A glide only moves between current and target
+            const int maxChunk = static_cast<int>(std::min({m_delayTapL.current, m_delayTapL.target,
+                                                            m_delayTapR.current, m_delayTapR.target}));
+            int count = std::min(numSamples - start, maxChunk);
+            float* outL = delayedL + start;
+            float* outR = delayedR + start;
+
+            if (m_delayGlideRemaining > 0) {
+                count = std::min(count, m_delayGlideRemaining);
+                alignas(16) float tapsL[kSmoothingBlock];
+                alignas(16) float tapsR[kSmoothingBlock];
+                const int done = kSmoothingBlock - m_delayGlideRemaining;
+                for (int j = 0; j < count; ++j) {
+                    tapsL[j] = m_delayTapL.at(done + j + 1);
+                    tapsR[j] = m_delayTapR.at(done + j + 1);
+                }
+                m_delayL.readBlock(outL, count, tapsL);
+                m_delayR.readBlock(outR, count, tapsR);
+                m_delayGlideRemaining -= count;
+                m_delayTapL.current = m_delayTapL.at(done + count);
+                m_delayTapR.current = m_delayTapR.at(done + count);
+            } else {
+                m_delayL.readBlock(outL, count, m_delayTapL.current);
+                m_delayR.readBlock(outR, count, m_delayTapR.current);
+            }
+            DELIVERB_PROFILE_STAGE(ProfileStage::DelayRead);
 
-        m_duckDelayAmount = 0.0f;
-        m_duckReverbAmount = 0.0f;
-        m_duckBehaviour = 0.5f;
+            m_delayTone.processBlock(outL, outR, count);
+            DELIVERB_PROFILE_STAGE(ProfileStage::DelayFilters);
 
-        m_advanced = false;
+            std::copy(outL, outL + count, feedbackL);
+            std::copy(outR, outR + count, feedbackR);
+            m_delayFeedbackFilter.processBlock(feedbackL, feedbackR, count);
+            for (int j = 0; j < count; ++j) {
+                feedbackL[j] = flushDenormal(dryL[start + j] + feedbackL[j] * delayRepeat);
+                feedbackR[j] = flushDenormal(dryR[start + j] + feedbackR[j] * delayRepeat);
+            }
+            m_delayL.writeBlock(feedbackL, count);
+            m_delayR.writeBlock(feedbackR, count);
+            DELIVERB_PROFILE_STAGE(ProfileStage::DelayFeedback);
+
+            start += count;
+        }
     }
 
-    void updateParameters() {
-        // Update reverb
-        m_reverb.setSize(m_reverbSize);
-        m_reverb.setStyle(m_reverbStyle);
-        m_reverb.setLowCut(m_reverbLowCut);
-        m_reverb.setHighCut(m_reverbHighCut);
-        m_reverb.setScoopAmount(m_reverbScoopAmount);
-
-        // Update delay filters
-        m_delayLowCutL.setCoefficients(Biquad::Type::HighPass, m_delayLowCut, 0.707);
-        m_delayLowCutR.setCoefficients(Biquad::Type::HighPass, m_delayLowCut, 0.707);
-        m_delayHighCutL.setCoefficients(Biquad::Type::LowPass, m_delayHighCut, 0.707);
-        m_delayHighCutR.setCoefficients(Biquad::Type::LowPass, m_delayHighCut, 0.707);
-
-        // Update delay scoop filter (500Hz center, -12dB max cut)
-        float delayScoopGain = m_delayScoopAmount * -12.0f;
-        m_delayScoopL.setCoefficients(Biquad::Type::Peak, 500.0, 0.7, delayScoopGain);
-        m_delayScoopR.setCoefficients(Biquad::Type::Peak, 500.0, 0.7, delayScoopGain);
-
-        // Update ducker
-        m_ducker.setDelayAmount(m_duckDelayAmount);
-        m_ducker.setReverbAmount(m_duckReverbAmount);
-        m_ducker.setBehaviour(m_duckBehaviour);
+    // Ducker settings are plain clamps, cheap enough to apply per sub-block
+    void applySmoothedDucking() {
+        m_ducker.setDelayAmount(m_smoothers.value(kSmoothDuckDelay));
+        m_ducker.setReverbAmount(m_smoothers.value(kSmoothDuckReverb));
+        m_ducker.setBehaviour(m_smoothers.value(kSmoothDuckBehaviour));
     }
 
     double m_sampleRate = 44100.0;
 
-    // Parameters
+    // Shared parameter values, written by any thread
+    ParameterStore<kNumParams> m_parameters;
+
+    // Render-side copies of the parameters, updated at block boundaries. For
+    // the smoothed ones these are the targets; the loop reads m_smoothers.
     float m_delayTime;
     float m_delayRepeat;
     float m_delayMix;
@@ -336,21 +712,59 @@ private:
     float m_duckBehaviour;
     bool m_advanced;
 
+    // Coefficient handoff. m_buildSet and m_builtSampleRate belong to
+    // whichever thread holds m_building.
+    TripleBuffer<CoefficientSet> m_coefficients;
+    CoefficientSet m_buildSet;
+    double m_builtSampleRate = 0.0;
+    std::atomic<double> m_controlSampleRate{44100.0};
+    std::atomic<bool> m_building{false};
+    std::atomic<bool> m_buildRequested{false};
+    uint32_t m_adoptedVersions[kNumDirtyGroups] = {};  // Render thread: versions of the adopted set
+
+    SmootherBank<kNumSmoothed> m_smoothers;
+    int m_smoothingCountdown = 0;  // Samples left before the next smoother step
+
+    // Read position of one delay line in samples, gliding linearly to each
+    // new smoothed delay time. Positions are counted from the start of the
+    // glide, so the taps don't depend on how the host splits its blocks.
+    struct DelayTapGlide {
+        float current = 1.0f;  // Tap of the last rendered sample
+        float from = 1.0f;
+        float target = 1.0f;
+        float step = 0.0f;
+
+        void snap(float tap) {
+            current = from = target = tap;
+            step = 0.0f;
+        }
+        void glideTo(float tap) {
+            from = current;
+            target = tap;
+            step = (target - from) / static_cast<float>(kSmoothingBlock);
+        }
+        // Tap for the sample `position` samples into the glide, 1..kSmoothingBlock
+        float at(int position) const {
+            return position >= kSmoothingBlock ? target : from + step * static_cast<float>(position);
+        }
+    };
+    DelayTapGlide m_delayTapL;
+    DelayTapGlide m_delayTapR;
+    int m_delayGlideRemaining = 0;  // Samples left in the current tap glide
+
     // DSP components
     DelayLine m_delayL;
     DelayLine m_delayR;
     Reverb m_reverb;
     Ducker m_ducker;
 
-    // Delay filters
-    Biquad m_delayLowCutL;
-    Biquad m_delayLowCutR;
-    Biquad m_delayHighCutL;
-    Biquad m_delayHighCutR;
-    Biquad m_delayScoopL;
-    Biquad m_delayScoopR;
-    Biquad m_delayFeedbackFilterL;
-    Biquad m_delayFeedbackFilterR;
+    // Delay return tone stack: low cut -> high cut -> scoop. The feedback
+    // filter branches off after it, so it stays a separate pair.
+    enum ToneStage { kToneLowCut = 0, kToneHighCut, kToneScoop, kNumToneStages };
+    StereoBiquadCascade<kNumToneStages> m_delayTone;
+    StereoBiquad m_delayFeedbackFilter;
+
+    RenderMonitor m_renderMonitor;
 };
 
 } // namespace DeliVerb
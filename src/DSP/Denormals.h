@@ -0,0 +1,59 @@
+#pragma once
+
+#include <cmath>
+#include <cstdint>
+
+#if defined(__SSE__) || defined(__x86_64__) || defined(_M_X64)
+#include <xmmintrin.h>
+#define DELIVERB_DENORMALS_SSE 1
+#endif
+
+namespace DeliVerb {
+
+// Values below this are treated as silence in recursive paths (-300 dB)
+inline constexpr float kDenormalThreshold = 1.0e-15f;
+
+// Explicit flush for feedback paths; also correct when FTZ is unavailable.
+// A compare-and-select, so -ffast-math cannot fold it away.
+inline float flushDenormal(float value) {
+    return std::abs(value) < kDenormalThreshold ? 0.0f : value;
+}
+
+inline double flushDenormal(double value) {
+    return std::abs(value) < static_cast<double>(kDenormalThreshold) ? 0.0 : value;
+}
+
+// Enables flush-to-zero / denormals-are-zero for the current thread and
+// restores the previous mode on destruction. Wrap every render call.
+class ScopedNoDenormals {
+public:
+    ScopedNoDenormals() {
+#if DELIVERB_DENORMALS_SSE
+        m_previous = _mm_getcsr();
+        _mm_setcsr(m_previous | 0x8040u); // FTZ (bit 15) | DAZ (bit 6)
+#elif defined(__aarch64__)
+        asm volatile("mrs %0, fpcr" : "=r"(m_previous));
+        asm volatile("msr fpcr, %0" : : "r"(m_previous | (1ull << 24))); // FZ
+#endif
+    }
+
+    ~ScopedNoDenormals() {
+#if DELIVERB_DENORMALS_SSE
+        _mm_setcsr(m_previous);
+#elif defined(__aarch64__)
+        asm volatile("msr fpcr, %0" : : "r"(m_previous));
+#endif
+    }
+
+    ScopedNoDenormals(const ScopedNoDenormals&) = delete;
+    ScopedNoDenormals& operator=(const ScopedNoDenormals&) = delete;
+
+private:
+#if DELIVERB_DENORMALS_SSE
+    unsigned int m_previous = 0;
+#else
+    uint64_t m_previous = 0;
+#endif
+};
+
+} // namespace DeliVerb
@@ -1,5 +1,6 @@
 #pragma once
 
+#include "Denormals.h"
 #include <cmath>
 #include <algorithm>
 
@@ -35,6 +36,7 @@ public:
             // Release phase
             m_envelope = m_releaseCoeff * m_envelope + (1.0f - m_releaseCoeff) * absInput;
         }
+        m_envelope = flushDenormal(m_envelope);
 
         return m_envelope;
     }
@@ -0,0 +1,59 @@
+#pragma once
+
+#include <atomic>
+#include <bit>
+#include <cstdint>
+
+namespace DeliVerb {
+
+// Wait-free parameter block shared between host/UI threads and the engine.
+//
+// Any thread may set() or get() a value at any time. One consumer at a time
+// (DeliVerbDSP's coefficient builder) calls consume() and is handed every
+// parameter changed since the last call. Each value is its own atomic; a
+// change bitmask tells the consumer which ones to look at. Writers store the
+// value first and then set its bit with release ordering, and consume() takes
+// the mask with acquire, so a consumed bit is never older than the value it
+// refers to. A value written between the exchange and the load is picked up
+// early and reported again on the next call, which is harmless.
+template<int NumParams>
+class ParameterStore {
+    static_assert(NumParams > 0 && NumParams <= 64, "change mask is a single 64-bit word");
+
+public:
+    ParameterStore() = default;
+    ParameterStore(const ParameterStore&) = delete;
+    ParameterStore& operator=(const ParameterStore&) = delete;
+
+    // Any thread
+    void set(int index, float value) {
+        m_values[index].store(value, std::memory_order_relaxed);
+        m_changed.fetch_or(uint64_t(1) << index, std::memory_order_release);
+    }
+
+    // Any thread; the most recently set value
+    float get(int index) const {
+        return m_values[index].load(std::memory_order_relaxed);
+    }
+
+    // One consumer at a time: calls apply(index, value) for each changed parameter
+    template<typename ApplyFn>
+    void consume(ApplyFn&& apply) {
+        if (m_changed.load(std::memory_order_relaxed) == 0) return;
+
+        uint64_t changed = m_changed.exchange(0, std::memory_order_acquire);
+        while (changed != 0) {
+            const int index = std::countr_zero(changed);
+            changed &= changed - 1;
+            apply(index, m_values[index].load(std::memory_order_relaxed));
+        }
+    }
+
+private:
+    // Values share cache lines with each other but not with the change mask,
+    // which every writer and the render thread touch
+    alignas(64) std::atomic<float> m_values[NumParams] = {};
+    alignas(64) std::atomic<uint64_t> m_changed{0};
+};
+
+} // namespace DeliVerb
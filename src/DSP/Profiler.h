@@ -0,0 +1,199 @@
+#pragma once
+
+// Per-stage hot-path profiler for the DSP entry points.
+//
+// Compiled in only when DELIVERB_PROFILING is defined to 1 (CMake option
+// DELIVERB_ENABLE_PROFILING); otherwise every macro expands to nothing.
+//
+//   DELIVERB_PROFILE_BLOCK("processStereo", numSamples);  // scope = one render call
+//   ...ducker code...
+//   DELIVERB_PROFILE_STAGE(ProfileStage::Ducker);         // ticks since last marker -> Ducker
+//
+// Stage markers are laps: each one charges the time since the previous
+// marker (or the block start) to its stage, so one counter read separates
+// two stages. The profiler is process-global and not thread-safe: profile
+// a single instance on a single thread.
+
+namespace DeliVerb {
+
+enum class ProfileStage : int {
+    ParameterUpdate = 0,
+    Ducker,
+    DelayRead,
+    DelayFilters,
+    DelayFeedback,
+    ReverbInputFilters,
+    ReverbPreDelay,
+    ReverbDiffusion,
+    ReverbCombs,
+    Mixing,
+    Limiter,
+    kCount
+};
+
+inline const char* profileStageName(ProfileStage stage) {
+    switch (stage) {
+        case ProfileStage::ParameterUpdate:    return "parameter updates";
+        case ProfileStage::Ducker:             return "ducker";
+        case ProfileStage::DelayRead:          return "delay read";
+        case ProfileStage::DelayFilters:       return "delay filters";
+        case ProfileStage::DelayFeedback:      return "delay feedback write";
+        case ProfileStage::ReverbInputFilters: return "reverb input filters";
+        case ProfileStage::ReverbPreDelay:     return "reverb pre-delay";
+        case ProfileStage::ReverbDiffusion:    return "reverb allpass diffusion";
+        case ProfileStage::ReverbCombs:        return "reverb comb bank";
+        case ProfileStage::Mixing:             return "mixing";
+        case ProfileStage::Limiter:            return "tanh limiter";
+        default:                               return "unknown";
+    }
+}
+
+} // namespace DeliVerb
+
+#if DELIVERB_PROFILING
+
+#include "CycleCounter.h"
+
+#include <array>
+#include <cstdint>
+#include <cstdio>
+
+namespace DeliVerb {
+
+class StageProfiler {
+public:
+    static constexpr int kNumStages = static_cast<int>(ProfileStage::kCount);
+    static constexpr size_t kMaxBlocks = 8192; // Blocks kept for the trace; totals keep counting
+
+    static StageProfiler& instance() {
+        static StageProfiler profiler;
+        return profiler;
+    }
+
+    void beginBlock(const char* name, int numFrames) {
+        m_current = {};
+        m_current.name = name;
+        m_current.numFrames = numFrames;
+        m_current.startTicks = CycleCounter::now();
+        m_lastTicks = m_current.startTicks;
+    }
+
+    void mark(ProfileStage stage) {
+        const uint64_t now = CycleCounter::now();
+        m_current.stageTicks[static_cast<int>(stage)] += now - m_lastTicks;
+        m_lastTicks = now;
+    }
+
+    void endBlock() {
+        m_current.endTicks = CycleCounter::now();
+        for (int s = 0; s < kNumStages; ++s) m_totalStageTicks[s] += m_current.stageTicks[s];
+        m_totalBlockTicks += m_current.endTicks - m_current.startTicks;
+        m_totalFrames += static_cast<uint64_t>(m_current.numFrames);
+        if (m_numBlocks < kMaxBlocks) m_blocks[m_numBlocks++] = m_current;
+    }
+
+    void clear() {
+        m_numBlocks = 0;
+        m_totalStageTicks = {};
+        m_totalBlockTicks = 0;
+        m_totalFrames = 0;
+    }
+
+    uint64_t totalFrames() const { return m_totalFrames; }
+    uint64_t stageTicks(ProfileStage stage) const { return m_totalStageTicks[static_cast<int>(stage)]; }
+
+    // Accumulated cost per stage: ticks/frame and share of the render calls
+    void writeSummary(FILE* out) const {
+        if (m_totalFrames == 0) return;
+        const double frames = static_cast<double>(m_totalFrames);
+        std::fprintf(out, "%-26s %14s %8s\n", "stage", "ticks/frame", "share");
+        for (int s = 0; s < kNumStages; ++s) {
+            std::fprintf(out, "%-26s %14.1f %7.1f%%\n", profileStageName(static_cast<ProfileStage>(s)),
+                         static_cast<double>(m_totalStageTicks[s]) / frames,
+                         100.0 * static_cast<double>(m_totalStageTicks[s]) / static_cast<double>(m_totalBlockTicks));
+        }
+        std::fprintf(out, "%-26s %14.1f\n", "total (render call)", static_cast<double>(m_totalBlockTicks) / frames);
+    }
+
+    // Chrome trace / Perfetto JSON. Each recorded render call is one event;
+    // its stages are nested below it, laid out back to back with their
+    // accumulated durations (stages interleave per sample in reality).
+    void writeChromeTrace(FILE* out) const {
+        const double ticksPerMicro = CycleCounter::ticksPerSecond() / 1.0e6;
+        const uint64_t origin = m_numBlocks > 0 ? m_blocks[0].startTicks : 0;
+
+        std::fprintf(out, "{\"displayTimeUnit\": \"ns\", \"traceEvents\": [\n");
+        std::fprintf(out, "  {\"name\": \"process_name\", \"ph\": \"M\", \"pid\": 1, \"args\": {\"name\": \"DeliVerbDSP\"}}");
+
+        for (size_t b = 0; b < m_numBlocks; ++b) {
+            const BlockRecord& block = m_blocks[b];
+            double ts = static_cast<double>(block.startTicks - origin) / ticksPerMicro;
+            std::fprintf(out, ",\n  {\"name\": \"%s\", \"cat\": \"render\", \"ph\": \"X\", \"pid\": 1, \"tid\": 1, "
+                              "\"ts\": %.3f, \"dur\": %.3f, \"args\": {\"frames\": %d}}",
+                         block.name, ts, static_cast<double>(block.endTicks - block.startTicks) / ticksPerMicro,
+                         block.numFrames);
+            for (int s = 0; s < kNumStages; ++s) {
+                if (block.stageTicks[s] == 0) continue;
+                const double dur = static_cast<double>(block.stageTicks[s]) / ticksPerMicro;
+                std::fprintf(out, ",\n  {\"name\": \"%s\", \"cat\": \"stage\", \"ph\": \"X\", \"pid\": 1, \"tid\": 1, "
+                                  "\"ts\": %.3f, \"dur\": %.3f}",
+                             profileStageName(static_cast<ProfileStage>(s)), ts, dur);
+                ts += dur;
+            }
+        }
+
+        std::fprintf(out, "\n], \"otherData\": {\"frames\": %llu, \"ticks_per_second\": %.0f",
+                     static_cast<unsigned long long>(m_totalFrames), CycleCounter::ticksPerSecond());
+        for (int s = 0; s < kNumStages; ++s) {
+            std::fprintf(out, ", \"%s ticks\": %llu", profileStageName(static_cast<ProfileStage>(s)),
+                         static_cast<unsigned long long>(m_totalStageTicks[s]));
+        }
+        std::fprintf(out, "}}\n");
+    }
+
+private:
+    struct BlockRecord {
+        const char* name = nullptr;
+        int numFrames = 0;
+        uint64_t startTicks = 0;
+        uint64_t endTicks = 0;
+        std::array<uint64_t, kNumStages> stageTicks = {};
+    };
+
+    StageProfiler() = default;
+
+    BlockRecord m_current;
+    uint64_t m_lastTicks = 0;
+
+    std::array<BlockRecord, kMaxBlocks> m_blocks;
+    size_t m_numBlocks = 0;
+
+    std::array<uint64_t, kNumStages> m_totalStageTicks = {};
+    uint64_t m_totalBlockTicks = 0;
+    uint64_t m_totalFrames = 0;
+};
+
+// Opens a block on construction and closes it when the render call returns
+class ScopedProfileBlock {
+public:
+    ScopedProfileBlock(const char* name, int numFrames) {
+        StageProfiler::instance().beginBlock(name, numFrames);
+    }
+    ~ScopedProfileBlock() { StageProfiler::instance().endBlock(); }
+
+    ScopedProfileBlock(const ScopedProfileBlock&) = delete;
+    ScopedProfileBlock& operator=(const ScopedProfileBlock&) = delete;
+};
+
+} // namespace DeliVerb
+
+#define DELIVERB_PROFILE_BLOCK(name, numFrames) \
+    ::DeliVerb::ScopedProfileBlock deliverbProfileBlock_((name), (numFrames))
+#define DELIVERB_PROFILE_STAGE(stage) ::DeliVerb::StageProfiler::instance().mark(stage)
+
+#else
+
+#define DELIVERB_PROFILE_BLOCK(name, numFrames) ((void)0)
+#define DELIVERB_PROFILE_STAGE(stage) ((void)0)
+
+#endif // DELIVERB_PROFILING
@@ -0,0 +1,188 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+
+namespace DeliVerb {
+
+// Lock-free deadline monitor for the render entry points.
+//
+// The audio thread records each block's execution time relative to its
+// real-time budget (frames / sample rate) into a load histogram, counts
+// deadline misses and keeps the worst block together with the parameter
+// state at that moment. Any other thread can take a snapshot at any time;
+// the audio thread never waits. Counters are single-writer atomics, the
+// worst-block record is published through a sequence lock.
+class RenderMonitor {
+public:
+    using Clock = std::chrono::steady_clock;
+
+    static constexpr int kNumBuckets = 32;            // Load buckets of 1/16 budget; the last one is open-ended
+    static constexpr double kBucketWidth = 1.0 / 16.0;
+    static constexpr int kMaxParams = 16;
+
+    struct WorstBlock {
+        double load = 0.0;               // Execution time / budget
+        uint64_t elapsedNs = 0;
+        int numFrames = 0;
+        uint64_t blockIndex = 0;         // Position in the block count
+        int numParams = 0;
+        std::array<float, kMaxParams> params = {};
+    };
+
+    struct Snapshot {
+        std::array<uint64_t, kNumBuckets> histogram = {};
+        uint64_t blocks = 0;
+        uint64_t deadlineMisses = 0;
+        double meanLoad = 0.0;
+        WorstBlock worst;
+
+        // Lower bound of the load covered by a histogram bucket
+        static double bucketLoad(int bucket) { return bucket * kBucketWidth; }
+    };
+
+    RenderMonitor() = default;
+    RenderMonitor(const RenderMonitor&) = delete;
+    RenderMonitor& operator=(const RenderMonitor&) = delete;
+
+    // Call while not rendering
+    void setSampleRate(double sampleRate) {
+        if (sampleRate > 0.0) m_nsPerFrame = 1.0e9 / sampleRate;
+    }
+
+    // Fraction of the block duration the render call may use before it
+    // counts as a miss (hosts need headroom for their own work)
+    void setDeadlineFraction(double fraction) {
+        m_deadlineFraction.store(fraction, std::memory_order_relaxed);
+    }
+
+    // ==================== AUDIO THREAD ====================
+
+    // paramAt(i) is only called when this block becomes the new worst block
+    template<typename ParamFn>
+    void recordBlock(Clock::time_point start, int numFrames, int numParams, ParamFn&& paramAt) {
+        if (numFrames <= 0) return;
+
+        if (m_resetRequested.exchange(false, std::memory_order_acquire)) {
+            clearStatistics();
+        }
+
+        const uint64_t elapsedNs = static_cast<uint64_t>(
+            std::chrono::duration_cast<std::chrono::nanoseconds>(Clock::now() - start).count());
+        const double load = static_cast<double>(elapsedNs) / (m_nsPerFrame * numFrames);
+
+        const int bucket = std::min(kNumBuckets - 1, static_cast<int>(load / kBucketWidth));
+        increment(m_histogram[bucket]);
+        const uint64_t blockIndex = increment(m_blocks) - 1;
+        m_loadSum.store(m_loadSum.load(std::memory_order_relaxed) + load, std::memory_order_relaxed);
+
+        if (load > m_deadlineFraction.load(std::memory_order_relaxed)) {
+            increment(m_deadlineMisses);
+        }
+
+        if (load > m_worstLoad) {
+            m_worstLoad = load;
+            publishWorst(load, elapsedNs, numFrames, blockIndex, std::min(numParams, kMaxParams), paramAt);
+        }
+    }
+
+    // ==================== ANY THREAD ====================
+
+    Snapshot snapshot() const {
+        Snapshot snap;
+        for (int i = 0; i < kNumBuckets; ++i) {
+            snap.histogram[i] = m_histogram[i].load(std::memory_order_relaxed);
+        }
+        snap.blocks = m_blocks.load(std::memory_order_relaxed);
+        snap.deadlineMisses = m_deadlineMisses.load(std::memory_order_relaxed);
+        snap.meanLoad = snap.blocks > 0 ? m_loadSum.load(std::memory_order_relaxed) / static_cast<double>(snap.blocks) : 0.0;
+
+        // Sequence lock read: retry while the audio thread is mid-update
+        for (;;) {
+            const uint32_t before = m_worstSequence.load(std::memory_order_acquire);
+            if (before & 1u) continue;
+
+            // Acquire loads keep the re-check of the sequence after the data
+            snap.worst.load = m_worst.load.load(std::memory_order_acquire);
+            snap.worst.elapsedNs = m_worst.elapsedNs.load(std::memory_order_acquire);
+            snap.worst.numFrames = m_worst.numFrames.load(std::memory_order_acquire);
+            snap.worst.blockIndex = m_worst.blockIndex.load(std::memory_order_acquire);
+            snap.worst.numParams = m_worst.numParams.load(std::memory_order_acquire);
+            for (int i = 0; i < kMaxParams; ++i) {
+                snap.worst.params[i] = m_worst.params[i].load(std::memory_order_acquire);
+            }
+
+            if (m_worstSequence.load(std::memory_order_relaxed) == before) break;
+        }
+        return snap;
+    }
+
+    // Statistics are cleared by the audio thread at its next block
+    void requestReset() {
+        m_resetRequested.store(true, std::memory_order_release);
+    }
+
+private:
+    struct AtomicWorstBlock {
+        std::atomic<double> load{0.0};
+        std::atomic<uint64_t> elapsedNs{0};
+        std::atomic<int> numFrames{0};
+        std::atomic<uint64_t> blockIndex{0};
+        std::atomic<int> numParams{0};
+        std::array<std::atomic<float>, kMaxParams> params = {};
+    };
+
+    // Single writer, so a plain load/store pair replaces the locked RMW
+    static uint64_t increment(std::atomic<uint64_t>& counter) {
+        const uint64_t value = counter.load(std::memory_order_relaxed) + 1;
+        counter.store(value, std::memory_order_relaxed);
+        return value;
+    }
+
+    template<typename ParamFn>
+    void publishWorst(double load, uint64_t elapsedNs, int numFrames, uint64_t blockIndex,
+                      int numParams, ParamFn& paramAt) {
+        // Release stores keep the odd sequence number ahead of the data
+        const uint32_t sequence = m_worstSequence.load(std::memory_order_relaxed);
+        m_worstSequence.store(sequence + 1, std::memory_order_relaxed);
+
+        m_worst.load.store(load, std::memory_order_release);
+        m_worst.elapsedNs.store(elapsedNs, std::memory_order_release);
+        m_worst.numFrames.store(numFrames, std::memory_order_release);
+        m_worst.blockIndex.store(blockIndex, std::memory_order_release);
+        m_worst.numParams.store(numParams, std::memory_order_release);
+        for (int i = 0; i < numParams; ++i) {
+            m_worst.params[i].store(paramAt(i), std::memory_order_release);
+        }
+
+        m_worstSequence.store(sequence + 2, std::memory_order_release);
+    }
+
+    void clearStatistics() {
+        for (auto& count : m_histogram) count.store(0, std::memory_order_relaxed);
+        m_blocks.store(0, std::memory_order_relaxed);
+        m_deadlineMisses.store(0, std::memory_order_relaxed);
+        m_loadSum.store(0.0, std::memory_order_relaxed);
+        m_worstLoad = 0.0;
+        auto none = [](int) { return 0.0f; };
+        publishWorst(0.0, 0, 0, 0, 0, none);
+    }
+
+    double m_nsPerFrame = 1.0e9 / 44100.0;
+    double m_worstLoad = 0.0;                      // Audio thread only
+    std::atomic<double> m_deadlineFraction{1.0};
+    std::atomic<bool> m_resetRequested{false};
+
+    std::array<std::atomic<uint64_t>, kNumBuckets> m_histogram = {};
+    std::atomic<uint64_t> m_blocks{0};
+    std::atomic<uint64_t> m_deadlineMisses{0};
+    std::atomic<double> m_loadSum{0.0};
+
+    std::atomic<uint32_t> m_worstSequence{0};
+    AtomicWorstBlock m_worst;
+};
+
+} // namespace DeliVerb
@@ -2,6 +2,9 @@
 
 #include "DelayLine.h"
 #include "Biquad.h"
+#include "Denormals.h"
+#include "Profiler.h"
+#include <algorithm>
 #include <cmath>
 #include <array>
 
@@ -11,6 +14,24 @@ namespace DeliVerb {
 // Supports style morphing from Classic to Atmospheric
 class Reverb {
 public:
+    static constexpr int kNumAllpass = 4;
+    static constexpr int kNumComb = 8;
+
+    // Everything process() derives from the parameters. The compute functions
+    // are pure so a control thread can build a set and hand it over whole.
+    struct Coefficients {
+        float preDelayMs = 25.0f;
+        float allpassDelays[kNumAllpass] = {};
+        float allpassFeedback = 0.5f;
+        float combDelays[kNumComb] = {};
+        float combFeedback = 0.8f;
+        float stereoSpread = 1.03f;
+        Biquad::Coefficients damping; // Shared by all 16 comb filters
+        Biquad::Coefficients lowCut;
+        Biquad::Coefficients highCut;
+        Biquad::Coefficients scoop;
+    };
+
     Reverb() = default;
 
     void setSampleRate(double sampleRate) {
@@ -28,9 +49,6 @@ public:
             m_combR[i].setSampleRate(sampleRate);
             m_combL[i].setMaxDelayMs(200.0f);
             m_combR[i].setMaxDelayMs(200.0f);
-
-            m_combFilterL[i].setSampleRate(sampleRate);
-            m_combFilterR[i].setSampleRate(sampleRate);
         }
 
         // Pre-delay
@@ -39,88 +57,231 @@ public:
         m_preDelayL.setMaxDelayMs(100.0f);
         m_preDelayR.setMaxDelayMs(100.0f);
 
-        // Input/output filters
-        m_inputLowCutL.setSampleRate(sampleRate);
-        m_inputLowCutR.setSampleRate(sampleRate);
-        m_inputHighCutL.setSampleRate(sampleRate);
-        m_inputHighCutR.setSampleRate(sampleRate);
-        m_inputScoopL.setSampleRate(sampleRate);
-        m_inputScoopR.setSampleRate(sampleRate);
-
+        // Damping and input filters are designed for the new rate here
         updateParameters();
     }
 
+    // Each setter recomputes only the state that depends on it
     void setSize(float size) {
-        m_size = std::max(0.0f, std::min(1.0f, size));
-        updateParameters();
+        m_size = size;
+        computeSize(m_coeffs, m_size);
+        updateDelayTaps();
     }
 
     void setStyle(float style) {
-        m_style = std::max(0.0f, std::min(1.0f, style));
-        updateParameters();
+        m_style = style;
+        computeStyle(m_coeffs, m_style, m_sampleRate);
+        loadDampingFilters();
     }
 
     void setLowCut(float freqHz) {
-        m_lowCutFreq = std::max(20.0f, std::min(2000.0f, freqHz));
-        updateFilters();
+        m_lowCutFreq = freqHz;
+        computeLowCut(m_coeffs, m_lowCutFreq, m_sampleRate);
+        loadInputFilters();
     }
 
     void setHighCut(float freqHz) {
-        m_highCutFreq = std::max(1000.0f, std::min(20000.0f, freqHz));
-        updateFilters();
+        m_highCutFreq = freqHz;
+        computeHighCut(m_coeffs, m_highCutFreq, m_sampleRate);
+        loadInputFilters();
     }
 
     void setScoopAmount(float amount) {
-        m_scoopAmount = std::max(0.0f, std::min(1.0f, amount));
-        updateFilters();
+        m_scoopAmount = amount;
+        computeScoop(m_coeffs, m_scoopAmount, m_sampleRate);
+        loadInputFilters();
+    }
+
+    // Takes a complete precomputed set; no transcendental math
+    void setCoefficients(const Coefficients& coeffs) {
+        m_coeffs = coeffs;
+        m_rampRemaining = 0;
+        updateDelayTaps();
+        loadDampingFilters();
+        loadInputFilters();
+    }
+
+    // Glides to a precomputed set over the next numSamples calls to
+    // process(): delay times, feedback and spread move linearly, the
+    // biquads interpolate their coefficients
+    void rampTo(const Coefficients& target, int numSamples) {
+        if (numSamples <= 1) {
+            setCoefficients(target);
+            return;
+        }
+        const float scale = 1.0f / static_cast<float>(numSamples);
+        m_rampTarget = target;
+        m_rampStep.preDelayMs = (target.preDelayMs - m_coeffs.preDelayMs) * scale;
+        for (int i = 0; i < kNumAllpass; ++i) {
+            m_rampStep.allpassDelays[i] = (target.allpassDelays[i] - m_coeffs.allpassDelays[i]) * scale;
+        }
+        m_rampStep.allpassFeedback = (target.allpassFeedback - m_coeffs.allpassFeedback) * scale;
+        for (int i = 0; i < kNumComb; ++i) {
+            m_rampStep.combDelays[i] = (target.combDelays[i] - m_coeffs.combDelays[i]) * scale;
+        }
+        m_rampStep.combFeedback = (target.combFeedback - m_coeffs.combFeedback) * scale;
+        m_rampStep.stereoSpread = (target.stereoSpread - m_coeffs.stereoSpread) * scale;
+        m_rampRemaining = numSamples;
+
+        m_combDamping.rampTo(target.damping, numSamples);
+        m_inputFilters.rampTo(kInputLowCut, target.lowCut, numSamples);
+        m_inputFilters.rampTo(kInputHighCut, target.highCut, numSamples);
+        m_inputFilters.rampTo(kInputScoop, target.scoop, numSamples);
+    }
+
+    // Jumps to the end of a ramp in progress
+    void finishRamp() {
+        if (m_rampRemaining > 0) setCoefficients(m_rampTarget);
+    }
+
+    static void computeSize(Coefficients& c, float size) {
+        size = std::max(0.0f, std::min(1.0f, size));
+
+        // Pre-delay increases with size
+        c.preDelayMs = 5.0f + size * 40.0f;
+
+        // Allpass delays (prime numbers in ms, scaled by size)
+        float sizeScale = 0.5f + size * 1.5f;
+        c.allpassDelays[0] = 4.77f * sizeScale;
+        c.allpassDelays[1] = 5.93f * sizeScale;
+        c.allpassDelays[2] = 7.11f * sizeScale;
+        c.allpassDelays[3] = 8.17f * sizeScale;
+
+        // Comb filter delays (prime numbers in ms, scaled by size)
+        c.combDelays[0] = 25.31f * sizeScale;
+        c.combDelays[1] = 26.93f * sizeScale;
+        c.combDelays[2] = 28.97f * sizeScale;
+        c.combDelays[3] = 30.71f * sizeScale;
+        c.combDelays[4] = 32.83f * sizeScale;
+        c.combDelays[5] = 34.49f * sizeScale;
+        c.combDelays[6] = 36.37f * sizeScale;
+        c.combDelays[7] = 38.89f * sizeScale;
+
+        // Feedback increases with size for longer decay
+        c.combFeedback = 0.7f + size * 0.25f;
+        c.combFeedback = std::min(0.98f, c.combFeedback);
+    }
+
+    static void computeStyle(Coefficients& c, float style, double sampleRate) {
+        style = std::max(0.0f, std::min(1.0f, style));
+
+        // Style affects diffusion amount
+        // Classic (0): Less diffusion, clearer echoes
+        // Atmospheric (1): More diffusion, washy sound
+        c.allpassFeedback = 0.5f + style * 0.25f;
+
+        // Style affects comb filter damping
+        // Classic: More high frequency damping (warmer)
+        // Atmospheric: Less damping (brighter, more diffuse)
+        float dampingFreq = 4000.0f + style * 8000.0f;
+        c.damping = Biquad::design(Biquad::Type::LowPass, dampingFreq, 0.707, 0.0, sampleRate);
+
+        // Stereo spread increases slightly with style
+        c.stereoSpread = 1.02f + style * 0.02f;
+    }
+
+    static void computeLowCut(Coefficients& c, float freqHz, double sampleRate) {
+        freqHz = std::max(20.0f, std::min(2000.0f, freqHz));
+        c.lowCut = Biquad::design(Biquad::Type::HighPass, freqHz, 0.707, 0.0, sampleRate);
+    }
+
+    static void computeHighCut(Coefficients& c, float freqHz, double sampleRate) {
+        freqHz = std::max(1000.0f, std::min(20000.0f, freqHz));
+        c.highCut = Biquad::design(Biquad::Type::LowPass, freqHz, 0.707, 0.0, sampleRate);
+    }
+
+    static void computeScoop(Coefficients& c, float amount, double sampleRate) {
+        amount = std::max(0.0f, std::min(1.0f, amount));
+
+        // Scoop filter (500Hz center, -12dB max cut)
+        float scoopGain = amount * -12.0f;
+        c.scoop = Biquad::design(Biquad::Type::Peak, 500.0, 0.7, scoopGain, sampleRate);
     }
 
     void process(float inputL, float inputR, float& outputL, float& outputR) {
+        if (m_rampRemaining > 0) stepRamp();
+
         // Apply input filters
-        float filteredL = m_inputLowCutL.process(inputL);
-        filteredL = m_inputHighCutL.process(filteredL);
-        filteredL = m_inputScoopL.process(filteredL);
-        float filteredR = m_inputLowCutR.process(inputR);
-        filteredR = m_inputHighCutR.process(filteredR);
-        filteredR = m_inputScoopR.process(filteredR);
-
-        // Pre-delay (increases with size)
-        float preDelayMs = 5.0f + m_size * 40.0f;
-        m_preDelayL.write(filteredL);
-        m_preDelayR.write(filteredR);
-        float preL = m_preDelayL.read(preDelayMs);
-        float preR = m_preDelayR.read(preDelayMs + 1.5f); // Slight stereo offset
+        float filteredL = inputL;
+        float filteredR = inputR;
+        m_inputFilters.process(filteredL, filteredR);
+        DELIVERB_PROFILE_STAGE(ProfileStage::ReverbInputFilters);
 
-        // Input diffusion through allpass chain
-        float diffL = preL;
-        float diffR = preR;
+        float diffL, diffR;
+        preDelay(filteredL, filteredR, diffL, diffR);
+        DELIVERB_PROFILE_STAGE(ProfileStage::ReverbPreDelay);
 
-        for (int i = 0; i < kNumAllpass; ++i) {
-            diffL = processAllpass(m_allpass[i], diffL, m_allpassDelays[i], m_allpassFeedback);
-            diffR = processAllpass(m_allpass[i], diffR, m_allpassDelays[i] * 1.03f, m_allpassFeedback);
-        }
+        diffuse(diffL, diffR);
+        DELIVERB_PROFILE_STAGE(ProfileStage::ReverbDiffusion);
 
         // Parallel comb filters
         float combSumL = 0.0f;
         float combSumR = 0.0f;
 
+        // Left combs in lanes 0-7, right in 8-15; the right channel uses
+        // slightly different delays for width
+        alignas(16) float combOut[2 * kNumComb];
         for (int i = 0; i < kNumComb; ++i) {
-            // Left channel
-            float combOutL = m_combL[i].read(m_combDelays[i]);
-            combOutL = m_combFilterL[i].process(combOutL);
-            m_combL[i].write(diffL + combOutL * m_combFeedback);
+            combOut[i] = m_combL[i].tap(m_taps.combL[i]);
+            combOut[kNumComb + i] = m_combR[i].tap(m_taps.combR[i]);
+        }
+        m_combDamping.process(combOut);
+        for (int i = 0; i < kNumComb; ++i) {
+            const float combOutL = combOut[i];
+            const float combOutR = combOut[kNumComb + i];
+            m_combL[i].write(flushDenormal(diffL + combOutL * m_coeffs.combFeedback));
+            m_combR[i].write(flushDenormal(diffR + combOutR * m_coeffs.combFeedback));
             combSumL += combOutL;
-
-            // Right channel (slightly different delays for width)
-            float combOutR = m_combR[i].read(m_combDelays[i] * m_stereoSpread);
-            combOutR = m_combFilterR[i].process(combOutR);
-            m_combR[i].write(diffR + combOutR * m_combFeedback);
             combSumR += combOutR;
         }
 
         // Scale output
         outputL = combSumL * 0.25f;
         outputR = combSumR * 0.25f;
+        DELIVERB_PROFILE_STAGE(ProfileStage::ReverbCombs);
+    }
+
+    // Same result as process() per sample. The input filters run as one
+    // pass and the comb bank in chunks no longer than its shortest comb: a
+    // comb's output for the whole chunk was written before the chunk
+    // started, so each comb is read and written back as a block, with only
+    // the damping filters stepping sample by sample across the 16 lanes.
+    // The allpass diffusers stay per sample. While a rampTo() is moving
+    // the delay times every sample, it falls back to process().
+    void processBlock(const float* inputL, const float* inputR, float* outputL, float* outputR, int numSamples) {
+        alignas(16) float diffL[kMaxBlock];
+        alignas(16) float diffR[kMaxBlock];
+
+        for (int start = 0; start < numSamples;) {
+            if (m_rampRemaining > 0) {
+                const int count = std::min(numSamples - start, m_rampRemaining);
+                for (int i = start; i < start + count; ++i) {
+                    process(inputL[i], inputR[i], outputL[i], outputR[i]);
+                }
+                start += count;
+                continue;
+            }
+            const int count = std::min({numSamples - start, kMaxBlock, m_taps.shortestComb});
+
+            std::copy(inputL + start, inputL + start + count, diffL);
+            std::copy(inputR + start, inputR + start + count, diffR);
+            m_inputFilters.processBlock(diffL, diffR, count);
+            DELIVERB_PROFILE_STAGE(ProfileStage::ReverbInputFilters);
+
+            for (int j = 0; j < count; ++j) {
+                preDelay(diffL[j], diffR[j], diffL[j], diffR[j]);
+            }
+            DELIVERB_PROFILE_STAGE(ProfileStage::ReverbPreDelay);
+
+            for (int j = 0; j < count; ++j) {
+                diffuse(diffL[j], diffR[j]);
+            }
+            DELIVERB_PROFILE_STAGE(ProfileStage::ReverbDiffusion);
+
+            processCombBlock(diffL, diffR, outputL + start, outputR + start, count);
+            DELIVERB_PROFILE_STAGE(ProfileStage::ReverbCombs);
+            start += count;
+        }
     }
 
     void reset() {
@@ -130,87 +291,152 @@ public:
         for (int i = 0; i < kNumComb; ++i) {
             m_combL[i].reset();
             m_combR[i].reset();
-            m_combFilterL[i].reset();
-            m_combFilterR[i].reset();
         }
+        m_combDamping.reset();
         m_preDelayL.reset();
         m_preDelayR.reset();
-        m_inputLowCutL.reset();
-        m_inputLowCutR.reset();
-        m_inputHighCutL.reset();
-        m_inputHighCutR.reset();
-        m_inputScoopL.reset();
-        m_inputScoopR.reset();
+        m_inputFilters.reset();
+    }
+
+    // Heap memory held by all delay lines
+    size_t memoryBytes() const {
+        size_t bytes = m_preDelayL.memoryBytes() + m_preDelayR.memoryBytes();
+        for (int i = 0; i < kNumAllpass; ++i) {
+            bytes += m_allpass[i].memoryBytes();
+        }
+        for (int i = 0; i < kNumComb; ++i) {
+            bytes += m_combL[i].memoryBytes() + m_combR[i].memoryBytes();
+        }
+        return bytes;
     }
 
 private:
-    static constexpr int kNumAllpass = 4;
-    static constexpr int kNumComb = 8;
+    // Longest chunk processBlock() handles at once; sizes its scratch
+    static constexpr int kMaxBlock = 64;
 
-    float processAllpass(DelayLine& delay, float input, float delayMs, float feedback) {
-        float delayed = delay.read(delayMs);
-        float output = -input + delayed;
-        delay.write(input + delayed * feedback);
-        return output;
+    // Pre-delay (increases with size), one sample. The callers mark the
+    // profile stages, once per sample in process() and once per chunk in
+    // processBlock().
+    void preDelay(float filteredL, float filteredR, float& delayedL, float& delayedR) {
+        m_preDelayL.write(filteredL);
+        m_preDelayR.write(filteredR);
+        delayedL = m_preDelayL.tap(m_taps.preDelayL);
+        delayedR = m_preDelayR.tap(m_taps.preDelayR);
     }
 
-    void updateParameters() {
-        // Allpass delays (prime numbers in ms, scaled by size)
-        float sizeScale = 0.5f + m_size * 1.5f;
-        m_allpassDelays[0] = 4.77f * sizeScale;
-        m_allpassDelays[1] = 5.93f * sizeScale;
-        m_allpassDelays[2] = 7.11f * sizeScale;
-        m_allpassDelays[3] = 8.17f * sizeScale;
+    // Input diffusion through the allpass chain, one sample in place
+    void diffuse(float& left, float& right) {
+        for (int i = 0; i < kNumAllpass; ++i) {
+            left = processAllpass(m_allpass[i], left, m_taps.allpassL[i], m_coeffs.allpassFeedback);
+            right = processAllpass(m_allpass[i], right, m_taps.allpassR[i], m_coeffs.allpassFeedback);
+        }
+    }
 
-        // Style affects diffusion amount
-        // Classic (0): Less diffusion, clearer echoes
-        // Atmospheric (1): More diffusion, washy sound
-        m_allpassFeedback = 0.5f + m_style * 0.25f;
+    // The comb bank over count <= m_taps.shortestComb samples: block reads,
+    // per-sample damping across the 16 lanes, block writes
+    void processCombBlock(const float* diffL, const float* diffR, float* outputL, float* outputR, int count) {
+        alignas(16) float combOut[2 * kNumComb][kMaxBlock];
+        for (int i = 0; i < kNumComb; ++i) {
+            m_combL[i].readBlock(combOut[i], count, m_taps.combL[i]);
+            m_combR[i].readBlock(combOut[kNumComb + i], count, m_taps.combR[i]);
+        }
 
-        // Comb filter delays (prime numbers in ms, scaled by size)
-        m_combDelays[0] = 25.31f * sizeScale;
-        m_combDelays[1] = 26.93f * sizeScale;
-        m_combDelays[2] = 28.97f * sizeScale;
-        m_combDelays[3] = 30.71f * sizeScale;
-        m_combDelays[4] = 32.83f * sizeScale;
-        m_combDelays[5] = 34.49f * sizeScale;
-        m_combDelays[6] = 36.37f * sizeScale;
-        m_combDelays[7] = 38.89f * sizeScale;
+        const float feedback = m_coeffs.combFeedback;
+        for (int j = 0; j < count; ++j) {
+            alignas(16) float lanes[2 * kNumComb];
+            for (int c = 0; c < 2 * kNumComb; ++c) lanes[c] = combOut[c][j];
+            m_combDamping.process(lanes);
+
+            float combSumL = 0.0f;
+            float combSumR = 0.0f;
+            for (int i = 0; i < kNumComb; ++i) {
+                const float combOutL = lanes[i];
+                const float combOutR = lanes[kNumComb + i];
+                // Reuse the read buffer for what gets written back
+                combOut[i][j] = flushDenormal(diffL[j] + combOutL * feedback);
+                combOut[kNumComb + i][j] = flushDenormal(diffR[j] + combOutR * feedback);
+                combSumL += combOutL;
+                combSumR += combOutR;
+            }
+            outputL[j] = combSumL * 0.25f;
+            outputR[j] = combSumR * 0.25f;
+        }
 
-        // Feedback increases with size for longer decay
-        m_combFeedback = 0.7f + m_size * 0.25f;
-        m_combFeedback = std::min(0.98f, m_combFeedback);
+        for (int i = 0; i < kNumComb; ++i) {
+            m_combL[i].writeBlock(combOut[i], count);
+            m_combR[i].writeBlock(combOut[kNumComb + i], count);
+        }
+    }
 
-        // Style affects comb filter damping
-        // Classic: More high frequency damping (warmer)
-        // Atmospheric: Less damping (brighter, more diffuse)
-        float dampingFreq = 4000.0f + m_style * 8000.0f;
+    float processAllpass(DelayLine& delay, float input, float delaySamples, float feedback) {
+        float delayed = delay.tap(delaySamples);
+        float output = -input + delayed;
+        delay.write(flushDenormal(input + delayed * feedback));
+        return output;
+    }
+
+    void stepRamp() {
+        if (--m_rampRemaining == 0) {
+            // Land exactly; the biquads finish their own ramps on this sample
+            m_coeffs = m_rampTarget;
+            updateDelayTaps();
+            return;
+        }
+        m_coeffs.preDelayMs += m_rampStep.preDelayMs;
+        for (int i = 0; i < kNumAllpass; ++i) {
+            m_coeffs.allpassDelays[i] += m_rampStep.allpassDelays[i];
+        }
+        m_coeffs.allpassFeedback += m_rampStep.allpassFeedback;
         for (int i = 0; i < kNumComb; ++i) {
-            m_combFilterL[i].setCoefficients(Biquad::Type::LowPass, dampingFreq, 0.707);
-            m_combFilterR[i].setCoefficients(Biquad::Type::LowPass, dampingFreq, 0.707);
+            m_coeffs.combDelays[i] += m_rampStep.combDelays[i];
         }
+        m_coeffs.combFeedback += m_rampStep.combFeedback;
+        m_coeffs.stereoSpread += m_rampStep.stereoSpread;
+        updateDelayTaps();
+    }
 
-        // Stereo spread increases slightly with style
-        m_stereoSpread = 1.02f + m_style * 0.02f;
+    // Converts the delay times in m_coeffs to clamped sample delays for
+    // DelayLine::tap(); runs on parameter changes and ramp steps only
+    void updateDelayTaps() {
+        m_taps.preDelayL = m_preDelayL.delaySamples(m_coeffs.preDelayMs);
+        m_taps.preDelayR = m_preDelayR.delaySamples(m_coeffs.preDelayMs + 1.5f); // Slight stereo offset
+        for (int i = 0; i < kNumAllpass; ++i) {
+            m_taps.allpassL[i] = m_allpass[i].delaySamples(m_coeffs.allpassDelays[i]);
+            m_taps.allpassR[i] = m_allpass[i].delaySamples(m_coeffs.allpassDelays[i] * 1.03f);
+        }
+        float shortest = m_combL[0].maxDelaySamples();
+        for (int i = 0; i < kNumComb; ++i) {
+            m_taps.combL[i] = m_combL[i].delaySamples(m_coeffs.combDelays[i]);
+            m_taps.combR[i] = m_combR[i].delaySamples(m_coeffs.combDelays[i] * m_coeffs.stereoSpread);
+            shortest = std::min({shortest, m_taps.combL[i], m_taps.combR[i]});
+        }
+        m_taps.shortestComb = static_cast<int>(shortest);
+    }
 
-        updateFilters();
+    void updateParameters() {
+        computeSize(m_coeffs, m_size);
+        computeStyle(m_coeffs, m_style, m_sampleRate);
+        computeLowCut(m_coeffs, m_lowCutFreq, m_sampleRate);
+        computeHighCut(m_coeffs, m_highCutFreq, m_sampleRate);
+        computeScoop(m_coeffs, m_scoopAmount, m_sampleRate);
+        updateDelayTaps();
+        loadDampingFilters();
+        loadInputFilters();
     }
 
-    void updateFilters() {
-        m_inputLowCutL.setCoefficients(Biquad::Type::HighPass, m_lowCutFreq, 0.707);
-        m_inputLowCutR.setCoefficients(Biquad::Type::HighPass, m_lowCutFreq, 0.707);
-        m_inputHighCutL.setCoefficients(Biquad::Type::LowPass, m_highCutFreq, 0.707);
-        m_inputHighCutR.setCoefficients(Biquad::Type::LowPass, m_highCutFreq, 0.707);
+    void loadDampingFilters() {
+        m_combDamping.setCoefficients(m_coeffs.damping);
+    }
 
-        // Scoop filter (500Hz center, -12dB max cut)
-        float scoopGain = m_scoopAmount * -12.0f;
-        m_inputScoopL.setCoefficients(Biquad::Type::Peak, 500.0, 0.7, scoopGain);
-        m_inputScoopR.setCoefficients(Biquad::Type::Peak, 500.0, 0.7, scoopGain);
+    void loadInputFilters() {
+        m_inputFilters.setCoefficients(kInputLowCut, m_coeffs.lowCut);
+        m_inputFilters.setCoefficients(kInputHighCut, m_coeffs.highCut);
+        m_inputFilters.setCoefficients(kInputScoop, m_coeffs.scoop);
     }
 
     double m_sampleRate = 44100.0;
 
-    // Parameters
+    // Parameters, as last set (clamped when computing)
     float m_size = 0.5f;       // Room size (0-1)
     float m_style = 0.0f;      // Classic (0) to Atmospheric (1)
     float m_lowCutFreq = 100.0f;
@@ -218,28 +444,36 @@ private:
     float m_scoopAmount = 0.0f; // Scoop amount (0-1)
 
     // Derived parameters
-    float m_allpassDelays[kNumAllpass];
-    float m_allpassFeedback = 0.5f;
-    float m_combDelays[kNumComb];
-    float m_combFeedback = 0.8f;
-    float m_stereoSpread = 1.03f;
+    Coefficients m_coeffs;
+
+    // m_coeffs' delay times in samples (see updateDelayTaps)
+    struct DelayTaps {
+        float preDelayL = 1.0f, preDelayR = 1.0f;
+        float allpassL[kNumAllpass] = {}, allpassR[kNumAllpass] = {};
+        float combL[kNumComb] = {}, combR[kNumComb] = {};
+        int shortestComb = 1; // Whole samples; bounds processBlock()'s chunks
+    };
+    DelayTaps m_taps;
+
+    // Ramp toward m_rampTarget (see rampTo); only the scalar fields of m_rampStep are used
+    Coefficients m_rampTarget;
+    Coefficients m_rampStep;
+    int m_rampRemaining = 0;
 
     // DSP components
     DelayLine m_allpass[kNumAllpass];
     DelayLine m_combL[kNumComb];
     DelayLine m_combR[kNumComb];
-    Biquad m_combFilterL[kNumComb];
-    Biquad m_combFilterR[kNumComb];
+    // Damping for all 16 combs. Float is plenty for a 4-12 kHz lowpass
+    // and fits four combs per register.
+    MultiBiquad<float, 2 * kNumComb> m_combDamping;
 
     DelayLine m_preDelayL;
     DelayLine m_preDelayR;
 
-    Biquad m_inputLowCutL;
-    Biquad m_inputLowCutR;
-    Biquad m_inputHighCutL;
-    Biquad m_inputHighCutR;
-    Biquad m_inputScoopL;
-    Biquad m_inputScoopR;
+    // Input tone stack: low cut -> high cut -> scoop
+    enum InputStage { kInputLowCut = 0, kInputHighCut, kInputScoop, kNumInputStages };
+    StereoBiquadCascade<kNumInputStages> m_inputFilters;
 };
 
 } // namespace DeliVerb
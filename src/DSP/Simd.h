@@ -0,0 +1,186 @@
+#pragma once
+
+#include "Denormals.h"
+
+#if defined(__SSE2__) || defined(_M_X64)
+#include <emmintrin.h>
+#define DELIVERB_SIMD_SSE2 1
+#elif defined(__aarch64__)
+#include <arm_neon.h>
+#define DELIVERB_SIMD_NEON 1
+#endif
+
+namespace DeliVerb::simd {
+
+// Two doubles or four floats processed together. Only exact IEEE
+// operations (no FMA, no approximations), so a lane gives bit-identical
+// results to the same scalar expression as long as the compiler keeps the
+// scalar code IEEE too: not under -ffast-math (the Release AU builds),
+// which lets it contract and reassociate the scalar side. load/store move
+// float samples, converting for Double2.
+#if DELIVERB_SIMD_SSE2
+
+struct Double2 {
+    __m128d v;
+    static constexpr int kSize = 2;
+
+    static Double2 set(double lo, double hi) { return {_mm_set_pd(hi, lo)}; }
+    static Double2 load(const float* p) { return set(p[0], p[1]); }
+    static Double2 load(const double* p) { return {_mm_loadu_pd(p)}; }
+    void store(float* p) const { p[0] = static_cast<float>(lo()); p[1] = static_cast<float>(hi()); }
+    static Double2 broadcast(double x) { return {_mm_set1_pd(x)}; }
+    static Double2 zero() { return {_mm_setzero_pd()}; }
+    double lo() const { return _mm_cvtsd_f64(v); }
+    double hi() const { return _mm_cvtsd_f64(_mm_unpackhi_pd(v, v)); }
+};
+
+inline Double2 operator+(Double2 a, Double2 b) { return {_mm_add_pd(a.v, b.v)}; }
+inline Double2 operator-(Double2 a, Double2 b) { return {_mm_sub_pd(a.v, b.v)}; }
+inline Double2 operator*(Double2 a, Double2 b) { return {_mm_mul_pd(a.v, b.v)}; }
+
+// Lane-wise DeliVerb::flushDenormal
+inline Double2 flushDenormal(Double2 x) {
+    const __m128d magnitude = _mm_andnot_pd(_mm_set1_pd(-0.0), x.v);
+    const __m128d tiny = _mm_cmplt_pd(magnitude, _mm_set1_pd(static_cast<double>(kDenormalThreshold)));
+    return {_mm_andnot_pd(tiny, x.v)};
+}
+
+// Rounds both lanes to float precision, as a float round trip would
+inline Double2 roundToFloat(Double2 x) { return {_mm_cvtps_pd(_mm_cvtpd_ps(x.v))}; }
+
+inline bool allZero(Double2 x) { return _mm_movemask_pd(_mm_cmpneq_pd(x.v, _mm_setzero_pd())) == 0; }
+
+struct Float4 {
+    __m128 v;
+    static constexpr int kSize = 4;
+
+    static Float4 set(float a, float b, float c, float d) { return {_mm_set_ps(d, c, b, a)}; }
+    static Float4 load(const float* p) { return {_mm_loadu_ps(p)}; }
+    void store(float* p) const { _mm_storeu_ps(p, v); }
+    static Float4 broadcast(float x) { return {_mm_set1_ps(x)}; }
+    static Float4 zero() { return {_mm_setzero_ps()}; }
+};
+
+inline Float4 operator+(Float4 a, Float4 b) { return {_mm_add_ps(a.v, b.v)}; }
+inline Float4 operator-(Float4 a, Float4 b) { return {_mm_sub_ps(a.v, b.v)}; }
+inline Float4 operator*(Float4 a, Float4 b) { return {_mm_mul_ps(a.v, b.v)}; }
+inline Float4 operator/(Float4 a, Float4 b) { return {_mm_div_ps(a.v, b.v)}; }
+
+inline Float4 flushDenormal(Float4 x) {
+    const __m128 magnitude = _mm_andnot_ps(_mm_set1_ps(-0.0f), x.v);
+    const __m128 tiny = _mm_cmplt_ps(magnitude, _mm_set1_ps(kDenormalThreshold));
+    return {_mm_andnot_ps(tiny, x.v)};
+}
+
+#elif DELIVERB_SIMD_NEON
+
+struct Double2 {
+    float64x2_t v;
+    static constexpr int kSize = 2;
+
+    static Double2 set(double lo, double hi) { return {vcombine_f64(vdup_n_f64(lo), vdup_n_f64(hi))}; }
+    static Double2 load(const float* p) { return {vcvt_f64_f32(vld1_f32(p))}; }
+    static Double2 load(const double* p) { return {vld1q_f64(p)}; }
+    void store(float* p) const { vst1_f32(p, vcvt_f32_f64(v)); }
+    static Double2 broadcast(double x) { return {vdupq_n_f64(x)}; }
+    static Double2 zero() { return {vdupq_n_f64(0.0)}; }
+    double lo() const { return vgetq_lane_f64(v, 0); }
+    double hi() const { return vgetq_lane_f64(v, 1); }
+};
+
+inline Double2 operator+(Double2 a, Double2 b) { return {vaddq_f64(a.v, b.v)}; }
+inline Double2 operator-(Double2 a, Double2 b) { return {vsubq_f64(a.v, b.v)}; }
+inline Double2 operator*(Double2 a, Double2 b) { return {vmulq_f64(a.v, b.v)}; }
+
+inline Double2 flushDenormal(Double2 x) {
+    const uint64x2_t tiny = vcaltq_f64(x.v, vdupq_n_f64(static_cast<double>(kDenormalThreshold)));
+    return {vbslq_f64(tiny, vdupq_n_f64(0.0), x.v)};
+}
+
+inline Double2 roundToFloat(Double2 x) { return {vcvt_f64_f32(vcvt_f32_f64(x.v))}; }
+
+inline bool allZero(Double2 x) { return vgetq_lane_f64(x.v, 0) == 0.0 && vgetq_lane_f64(x.v, 1) == 0.0; }
+
+struct Float4 {
+    float32x4_t v;
+    static constexpr int kSize = 4;
+
+    static Float4 set(float a, float b, float c, float d) {
+        const float lanes[4] = {a, b, c, d};
+        return {vld1q_f32(lanes)};
+    }
+    static Float4 load(const float* p) { return {vld1q_f32(p)}; }
+    void store(float* p) const { vst1q_f32(p, v); }
+    static Float4 broadcast(float x) { return {vdupq_n_f32(x)}; }
+    static Float4 zero() { return {vdupq_n_f32(0.0f)}; }
+};
+
+inline Float4 operator+(Float4 a, Float4 b) { return {vaddq_f32(a.v, b.v)}; }
+inline Float4 operator-(Float4 a, Float4 b) { return {vsubq_f32(a.v, b.v)}; }
+inline Float4 operator*(Float4 a, Float4 b) { return {vmulq_f32(a.v, b.v)}; }
+inline Float4 operator/(Float4 a, Float4 b) { return {vdivq_f32(a.v, b.v)}; }
+
+inline Float4 flushDenormal(Float4 x) {
+    const uint32x4_t tiny = vcaltq_f32(x.v, vdupq_n_f32(kDenormalThreshold));
+    return {vbslq_f32(tiny, vdupq_n_f32(0.0f), x.v)};
+}
+
+#else
+
+struct Double2 {
+    double l, h;
+    static constexpr int kSize = 2;
+
+    static Double2 set(double lo, double hi) { return {lo, hi}; }
+    static Double2 load(const float* p) { return {p[0], p[1]}; }
+    static Double2 load(const double* p) { return {p[0], p[1]}; }
+    void store(float* p) const { p[0] = static_cast<float>(l); p[1] = static_cast<float>(h); }
+    static Double2 broadcast(double x) { return {x, x}; }
+    static Double2 zero() { return {0.0, 0.0}; }
+    double lo() const { return l; }
+    double hi() const { return h; }
+};
+
+inline Double2 operator+(Double2 a, Double2 b) { return {a.l + b.l, a.h + b.h}; }
+inline Double2 operator-(Double2 a, Double2 b) { return {a.l - b.l, a.h - b.h}; }
+inline Double2 operator*(Double2 a, Double2 b) { return {a.l * b.l, a.h * b.h}; }
+
+inline Double2 flushDenormal(Double2 x) {
+    return {DeliVerb::flushDenormal(x.l), DeliVerb::flushDenormal(x.h)};
+}
+
+inline Double2 roundToFloat(Double2 x) {
+    return {static_cast<double>(static_cast<float>(x.l)), static_cast<double>(static_cast<float>(x.h))};
+}
+
+inline bool allZero(Double2 x) { return x.l == 0.0 && x.h == 0.0; }
+
+struct Float4 {
+    float f[4];
+    static constexpr int kSize = 4;
+
+    static Float4 set(float a, float b, float c, float d) { return {{a, b, c, d}}; }
+    static Float4 load(const float* p) { return {{p[0], p[1], p[2], p[3]}}; }
+    void store(float* p) const { for (int i = 0; i < 4; ++i) p[i] = f[i]; }
+    static Float4 broadcast(float x) { return {{x, x, x, x}}; }
+    static Float4 zero() { return {{0.0f, 0.0f, 0.0f, 0.0f}}; }
+};
+
+inline Float4 operator+(Float4 a, Float4 b) { return {{a.f[0] + b.f[0], a.f[1] + b.f[1], a.f[2] + b.f[2], a.f[3] + b.f[3]}}; }
+inline Float4 operator-(Float4 a, Float4 b) { return {{a.f[0] - b.f[0], a.f[1] - b.f[1], a.f[2] - b.f[2], a.f[3] - b.f[3]}}; }
+inline Float4 operator*(Float4 a, Float4 b) { return {{a.f[0] * b.f[0], a.f[1] * b.f[1], a.f[2] * b.f[2], a.f[3] * b.f[3]}}; }
+inline Float4 operator/(Float4 a, Float4 b) { return {{a.f[0] / b.f[0], a.f[1] / b.f[1], a.f[2] / b.f[2], a.f[3] / b.f[3]}}; }
+
+inline Float4 flushDenormal(Float4 x) {
+    return {{DeliVerb::flushDenormal(x.f[0]), DeliVerb::flushDenormal(x.f[1]),
+             DeliVerb::flushDenormal(x.f[2]), DeliVerb::flushDenormal(x.f[3])}};
+}
+
+#endif
+
+// The vector type holding lanes of T
+template<typename T> struct VectorOf;
+template<> struct VectorOf<float> { using Type = Float4; };
+template<> struct VectorOf<double> { using Type = Double2; };
+
+} // namespace DeliVerb::simd
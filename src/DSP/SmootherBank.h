@@ -0,0 +1,69 @@
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+
+namespace DeliVerb {
+
+// One-pole smoothers for a group of parameters, stored structure-of-arrays
+// so a single advance() updates every lane with a few vector operations.
+//
+// advance() is meant to run once per sub-block (every stepSamples samples),
+// not per sample. Lanes that reach their target snap onto it exactly; once
+// every lane has settled the bank is idle and advance() is a single branch.
+template<int NumLanes>
+class SmootherBank {
+    static_assert(NumLanes > 0 && NumLanes <= 32, "settled mask is a 32-bit word");
+
+public:
+    // Time to cover ~63% of a step, for advance() called every stepSamples
+    void setTimeConstant(int lane, float timeMs, double sampleRate, int stepSamples) {
+        const double steps = std::max(1.0, timeMs * 0.001 * sampleRate / stepSamples);
+        m_coeff[lane] = static_cast<float>(1.0 - std::exp(-1.0 / steps));
+    }
+
+    // Differences below this count as settled
+    void setTolerance(int lane, float tolerance) {
+        m_tolerance[lane] = tolerance;
+    }
+
+    void setTarget(int lane, float target) {
+        m_target[lane] = target;
+        if (target != m_current[lane]) m_active |= uint32_t(1) << lane;
+    }
+
+    // Jump every lane to its target
+    void snap() {
+        std::copy(std::begin(m_target), std::end(m_target), m_current);
+        m_active = 0;
+    }
+
+    // Moves every lane one step toward its target; false if already settled
+    bool advance() {
+        if (m_active == 0) return false;
+
+        uint32_t active = 0;
+        for (int i = 0; i < NumLanes; ++i) {
+            const float diff = m_target[i] - m_current[i];
+            const bool settled = std::abs(diff) <= m_tolerance[i];
+            m_current[i] = settled ? m_target[i] : m_current[i] + diff * m_coeff[i];
+            active |= settled ? 0u : uint32_t(1) << i;
+        }
+        m_active = active;
+        return true;
+    }
+
+    float value(int lane) const { return m_current[lane]; }
+    float target(int lane) const { return m_target[lane]; }
+    bool isSettled() const { return m_active == 0; }
+
+private:
+    alignas(32) float m_current[NumLanes] = {};
+    alignas(32) float m_target[NumLanes] = {};
+    alignas(32) float m_coeff[NumLanes] = {};
+    alignas(32) float m_tolerance[NumLanes] = {};
+    uint32_t m_active = 0; // Bit per lane still moving
+};
+
+} // namespace DeliVerb
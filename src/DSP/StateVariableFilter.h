@@ -0,0 +1,124 @@
+#pragma once
+
+#include "Denormals.h"
+#include <algorithm>
+#include <cmath>
+
+namespace DeliVerb {
+
+// tan(x) for 0 <= x <= 0.49 * pi, as a [5/4] Pade approximant: worst
+// relative error 3e-4 at the top of the range, no branches, one division.
+// Enough for prewarping a cutoff; the result never hits the pole at pi/2.
+inline float fastTan(float x) {
+    const float x2 = x * x;
+    return x * (945.0f - 105.0f * x2 + x2 * x2) / (945.0f - 420.0f * x2 + 15.0f * x2 * x2);
+}
+
+// Topology-preserving transform (trapezoidal) state-variable filter. Unlike
+// a direct-form biquad its state is the two integrators, so the cutoff and
+// resonance can change every sample without blowing up or clicking: a
+// cutoff update is one fastTan() and one division. Use it wherever a filter
+// is swept or modulated; Biquad stays the choice for fixed tone stacks.
+class StateVariableFilter {
+public:
+    enum class Type {
+        LowPass,
+        HighPass,
+        BandPass,   // 0 dB peak gain, like Biquad's
+        Notch,
+        AllPass,
+        Peak        // Bell; gain set by setGainDB
+    };
+
+    StateVariableFilter() { updateCoefficients(); }
+
+    void setSampleRate(double sampleRate) {
+        m_sampleRate = sampleRate;
+        updateCoefficients();
+    }
+
+    void setType(Type type) {
+        m_type = type;
+        updateCoefficients();
+    }
+
+    // Cheap enough to call every sample
+    void setCutoff(float frequency) {
+        m_cutoff = frequency;
+        updateCoefficients();
+    }
+
+    // Q > 0; 0.707 is Butterworth
+    void setResonance(float Q) {
+        m_Q = std::max(0.05f, Q);
+        updateCoefficients();
+    }
+
+    void setGainDB(float gainDB) {
+        m_A = std::pow(10.0f, gainDB / 40.0f);
+        updateCoefficients();
+    }
+
+    float process(float input) {
+        const float v3 = input - m_ic2;
+        const float v1 = m_a1 * m_ic1 + m_a2 * v3;      // Bandpass
+        const float v2 = m_ic2 + m_a2 * m_ic1 + m_a3 * v3; // Lowpass
+        m_ic1 = flushDenormal(2.0f * v1 - m_ic1);
+        m_ic2 = flushDenormal(2.0f * v2 - m_ic2);
+        return m_m0 * input + m_m1 * v1 + m_m2 * v2;
+    }
+
+    void processBlock(float* buffer, int numSamples) {
+        for (int i = 0; i < numSamples; ++i) {
+            buffer[i] = process(buffer[i]);
+        }
+    }
+
+    void reset() {
+        m_ic1 = 0.0f;
+        m_ic2 = 0.0f;
+    }
+
+private:
+    void updateCoefficients() {
+        const float nyquistLimit = 0.49f * static_cast<float>(m_sampleRate);
+        const float cutoff = std::clamp(m_cutoff, 1.0f, nyquistLimit);
+        const float g = fastTan(static_cast<float>(M_PI) * cutoff / static_cast<float>(m_sampleRate));
+
+        // Bell: the resonance narrows with gain so boost and cut mirror each other
+        m_k = m_type == Type::Peak ? 1.0f / (m_Q * m_A) : 1.0f / m_Q;
+        m_a1 = 1.0f / (1.0f + g * (g + m_k));
+        m_a2 = g * m_a1;
+        m_a3 = g * m_a2;
+        updateMix();
+    }
+
+    // Output = m0 * input + m1 * bandpass + m2 * lowpass
+    void updateMix() {
+        switch (m_type) {
+            case Type::LowPass:  m_m0 = 0.0f; m_m1 = 0.0f;               m_m2 = 1.0f;  break;
+            case Type::HighPass: m_m0 = 1.0f; m_m1 = -m_k;               m_m2 = -1.0f; break;
+            case Type::BandPass: m_m0 = 0.0f; m_m1 = m_k;                m_m2 = 0.0f;  break;
+            case Type::Notch:    m_m0 = 1.0f; m_m1 = -m_k;               m_m2 = 0.0f;  break;
+            case Type::AllPass:  m_m0 = 1.0f; m_m1 = -2.0f * m_k;        m_m2 = 0.0f;  break;
+            case Type::Peak:     m_m0 = 1.0f; m_m1 = m_k * (m_A * m_A - 1.0f); m_m2 = 0.0f; break;
+        }
+    }
+
+    double m_sampleRate = 44100.0;
+
+    Type m_type = Type::LowPass;
+    float m_cutoff = 1000.0f;
+    float m_Q = 0.707f;
+    float m_A = 1.0f; // Bell amplitude, 10^(dB/40)
+
+    // Coefficients
+    float m_k = 1.0f / 0.707f;
+    float m_a1 = 1.0f, m_a2 = 0.0f, m_a3 = 0.0f;
+    float m_m0 = 0.0f, m_m1 = 0.0f, m_m2 = 1.0f;
+
+    // Integrator states
+    float m_ic1 = 0.0f, m_ic2 = 0.0f;
+};
+
+} // namespace DeliVerb
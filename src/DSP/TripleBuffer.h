@@ -0,0 +1,53 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+
+namespace DeliVerb {
+
+// Wait-free single-writer / single-reader handoff of a value too large for
+// an atomic (RCU-style: the reader keeps using its copy until it swaps).
+//
+// Three slots rotate between the roles back (being written), middle (latest
+// published) and front (in use by the reader). publish() and update() each
+// swap their slot with the middle one in a single atomic exchange, so
+// neither side ever waits or allocates, and a slot is reclaimed simply by
+// rotating back to the writer once the reader has moved past it.
+template<typename T>
+class TripleBuffer {
+public:
+    TripleBuffer() = default;
+    TripleBuffer(const TripleBuffer&) = delete;
+    TripleBuffer& operator=(const TripleBuffer&) = delete;
+
+    // Writer: the slot to fill before publish()
+    T& back() { return m_slots[m_back]; }
+
+    // Writer: makes back() the latest value and takes a free slot
+    void publish() {
+        const uint8_t previous = m_middle.exchange(static_cast<uint8_t>(m_back | kFresh), std::memory_order_acq_rel);
+        m_back = previous & kIndexMask;
+    }
+
+    // Reader: switches front() to the latest published value; false if there is none newer
+    bool update() {
+        if ((m_middle.load(std::memory_order_relaxed) & kFresh) == 0) return false;
+        const uint8_t previous = m_middle.exchange(m_front, std::memory_order_acq_rel);
+        m_front = previous & kIndexMask;
+        return true;
+    }
+
+    // Reader: the value in use
+    const T& front() const { return m_slots[m_front]; }
+
+private:
+    static constexpr uint8_t kIndexMask = 0x3;
+    static constexpr uint8_t kFresh = 0x4;
+
+    T m_slots[3] = {};
+    alignas(64) uint8_t m_back = 0;              // Writer side
+    alignas(64) std::atomic<uint8_t> m_middle{1};
+    alignas(64) uint8_t m_front = 2;             // Reader side
+};
+
+} // namespace DeliVerb
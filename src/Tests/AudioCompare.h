@@ -0,0 +1,101 @@
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <complex>
+#include <limits>
+#include <vector>
+
+namespace DeliVerb::Test {
+
+// Error metrics for comparing a rendered signal against a reference
+
+inline double maxAbsError(const std::vector<float>& reference, const std::vector<float>& test) {
+    double maxError = 0.0;
+    const size_t n = std::min(reference.size(), test.size());
+    for (size_t i = 0; i < n; ++i) {
+        maxError = std::max(maxError, std::abs(static_cast<double>(reference[i]) - test[i]));
+    }
+    return maxError;
+}
+
+// Signal-to-noise ratio in dB, treating the difference as noise.
+// Identical signals return +infinity.
+inline double snrDB(const std::vector<float>& reference, const std::vector<float>& test) {
+    double signal = 0.0;
+    double noise = 0.0;
+    const size_t n = std::min(reference.size(), test.size());
+    for (size_t i = 0; i < n; ++i) {
+        const double diff = static_cast<double>(reference[i]) - test[i];
+        signal += static_cast<double>(reference[i]) * reference[i];
+        noise += diff * diff;
+    }
+    if (noise == 0.0) return std::numeric_limits<double>::infinity();
+    if (signal == 0.0) return -std::numeric_limits<double>::infinity();
+    return 10.0 * std::log10(signal / noise);
+}
+
+// In-place iterative radix-2 FFT; size must be a power of two
+inline void fft(std::vector<std::complex<double>>& data) {
+    const size_t n = data.size();
+    for (size_t i = 1, j = 0; i < n; ++i) {
+        size_t bit = n >> 1;
+        for (; j & bit; bit >>= 1) j ^= bit;
+        j ^= bit;
+        if (i < j) std::swap(data[i], data[j]);
+    }
+    for (size_t length = 2; length <= n; length <<= 1) {
+        const double angle = -2.0 * M_PI / static_cast<double>(length);
+        const std::complex<double> step(std::cos(angle), std::sin(angle));
+        for (size_t start = 0; start < n; start += length) {
+            std::complex<double> w(1.0, 0.0);
+            for (size_t k = 0; k < length / 2; ++k) {
+                const auto even = data[start + k];
+                const auto odd = data[start + k + length / 2] * w;
+                data[start + k] = even + odd;
+                data[start + k + length / 2] = even - odd;
+                w *= step;
+            }
+        }
+    }
+}
+
+// Mean log-spectral distance in dB over Hann-windowed frames.
+// Bin magnitudes are floored at floorDB so silent regions do not dominate.
+inline double spectralDistanceDB(const std::vector<float>& reference, const std::vector<float>& test,
+                                 size_t frameSize = 1024, double floorDB = -100.0) {
+    const size_t n = std::min(reference.size(), test.size());
+    if (n < frameSize) return 0.0;
+
+    const double floorMagnitude = std::pow(10.0, floorDB / 20.0);
+    std::vector<double> window(frameSize);
+    for (size_t i = 0; i < frameSize; ++i) {
+        window[i] = 0.5 - 0.5 * std::cos(2.0 * M_PI * static_cast<double>(i) / static_cast<double>(frameSize));
+    }
+
+    std::vector<std::complex<double>> refSpectrum(frameSize), testSpectrum(frameSize);
+    double total = 0.0;
+    size_t count = 0;
+
+    for (size_t start = 0; start + frameSize <= n; start += frameSize / 2) {
+        for (size_t i = 0; i < frameSize; ++i) {
+            refSpectrum[i] = reference[start + i] * window[i];
+            testSpectrum[i] = test[start + i] * window[i];
+        }
+        fft(refSpectrum);
+        fft(testSpectrum);
+
+        double sumSquares = 0.0;
+        for (size_t bin = 0; bin <= frameSize / 2; ++bin) {
+            const double refDB = 20.0 * std::log10(std::max(std::abs(refSpectrum[bin]), floorMagnitude));
+            const double testDB = 20.0 * std::log10(std::max(std::abs(testSpectrum[bin]), floorMagnitude));
+            sumSquares += (refDB - testDB) * (refDB - testDB);
+        }
+        total += std::sqrt(sumSquares / static_cast<double>(frameSize / 2 + 1));
+        ++count;
+    }
+
+    return count > 0 ? total / static_cast<double>(count) : 0.0;
+}
+
+} // namespace DeliVerb::Test
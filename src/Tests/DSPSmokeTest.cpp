@@ -0,0 +1,806 @@
+// Smoke test for the portable DSP core: builds the full engine off-Mac,
+// renders an impulse through both entry points at every supported sample
+// rate and checks the output is finite and actually carries the effect.
+
+#include "AudioCompare.h"
+#include "DeliVerbDSP.h"
+#include "StateVariableFilter.h"
+#include "TestSignals.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <string>
+#include <utility>
+#include <vector>
+
+using namespace DeliVerb;
+
+namespace {
+
+int g_failures = 0;
+
+void check(bool condition, const char* what, double sampleRate) {
+    if (!condition) {
+        std::fprintf(stderr, "FAIL [%.0f Hz]: %s\n", sampleRate, what);
+        ++g_failures;
+    }
+}
+
+bool allFinite(const std::vector<float>& buffer) {
+    for (float sample : buffer) {
+        if (!std::isfinite(sample)) return false;
+    }
+    return true;
+}
+
+// Energy after the dry impulse has passed, i.e. delay and reverb only
+double tailEnergy(const std::vector<float>& buffer) {
+    double energy = 0.0;
+    for (size_t i = 1; i < buffer.size(); ++i) {
+        energy += static_cast<double>(buffer[i]) * buffer[i];
+    }
+    return energy;
+}
+
+void runAtSampleRate(double sampleRate) {
+    const int numFrames = static_cast<int>(sampleRate); // one second
+    std::vector<float> input(numFrames, 0.0f);
+    input[0] = 1.0f;
+
+    std::vector<float> outL(numFrames), outR(numFrames);
+
+    DeliVerbDSP dsp;
+    dsp.setSampleRate(sampleRate);
+    dsp.reset();
+    dsp.processStereo(input.data(), input.data(), outL.data(), outR.data(), numFrames);
+
+    check(allFinite(outL) && allFinite(outR), "stereo output is finite", sampleRate);
+    check(tailEnergy(outL) > 1e-6 && tailEnergy(outR) > 1e-6, "stereo output has a wet tail", sampleRate);
+
+    dsp.reset();
+    dsp.process(input.data(), outL.data(), outR.data(), numFrames);
+
+    check(allFinite(outL) && allFinite(outR), "mono output is finite", sampleRate);
+    check(tailEnergy(outL) > 1e-6 && tailEnergy(outR) > 1e-6, "mono output has a wet tail", sampleRate);
+
+    // Fully dry settings must pass the input through the limiter only
+    dsp.setParameter(DeliVerbDSP::kDelayMix, 0.0f);
+    dsp.setParameter(DeliVerbDSP::kReverbMix, 0.0f);
+    dsp.reset();
+    dsp.processStereo(input.data(), input.data(), outL.data(), outR.data(), numFrames);
+
+    const float expected = std::tanh(0.9f) / 0.9f;
+    check(std::abs(outL[0] - expected) < 1e-6f, "dry path is the limited input", sampleRate);
+    check(tailEnergy(outL) < 1e-12, "dry path has no tail", sampleRate);
+}
+
+// A non-default value for every ParamID
+constexpr float kChangedValues[DeliVerbDSP::kNumParams] = {
+    420.0f, 0.6f, 0.5f, 0.8f, 0.7f, 0.5f,   // delay time/repeat/mix, reverb size/style/mix
+    300.0f, 3000.0f, 1.0f,                  // delay low cut, high cut, scoop
+    400.0f, 4000.0f, 1.0f,                  // reverb low cut, high cut, scoop
+    1.0f, 1.0f, 0.2f,                       // duck delay, duck reverb, behaviour
+    1.0f,                                   // advanced
+};
+
+// Changing one parameter on a running instance must recompute everything it
+// affects: the output has to match an instance that computed all state fresh
+void checkIncrementalUpdates(double sampleRate) {
+    const int numFrames = static_cast<int>(sampleRate / 8); // long enough to reach the combs
+    std::vector<float> input(numFrames, 0.0f);
+    input[0] = 1.0f;
+    std::vector<float> refL(numFrames), refR(numFrames), outL(numFrames), outR(numFrames);
+
+    for (int p = 0; p < DeliVerbDSP::kNumParams; ++p) {
+        const auto param = static_cast<DeliVerbDSP::ParamID>(p);
+
+        DeliVerbDSP fresh;
+        fresh.setParameter(param, kChangedValues[p]);
+        fresh.setSampleRate(sampleRate);
+        fresh.reset();
+        fresh.processStereo(input.data(), input.data(), refL.data(), refR.data(), numFrames);
+
+        DeliVerbDSP running;
+        running.setSampleRate(sampleRate);
+        running.processStereo(input.data(), input.data(), outL.data(), outR.data(), 64);
+        running.setParameter(param, kChangedValues[p]);
+        running.processStereo(input.data(), input.data(), outL.data(), outR.data(), 1);
+        running.reset();
+        running.processStereo(input.data(), input.data(), outL.data(), outR.data(), numFrames);
+
+        if (refL != outL || refR != outR) {
+            std::fprintf(stderr, "FAIL [%.0f Hz]: incremental update of param %d differs from full recompute\n",
+                         sampleRate, p);
+            ++g_failures;
+        }
+    }
+}
+
+// Smoother bank glides toward new targets, lands on them exactly and goes
+// idle; a DSP glide is the same whatever block size the host renders with
+void checkSmoothers() {
+    const double sampleRate = 48000.0;
+
+    SmootherBank<2> bank;
+    bank.setTimeConstant(0, 10.0f, sampleRate, 16);
+    bank.setTimeConstant(1, 10.0f, sampleRate, 16);
+    bank.setTolerance(0, 1.0e-5f);
+    bank.setTolerance(1, 1.0e-5f);
+    bank.setTarget(1, 0.25f);
+    bank.snap();
+    bank.setTarget(0, 1.0f);
+
+    bool monotonic = true;
+    float previous = bank.value(0);
+    int steps = 0;
+    while (bank.advance() && steps < 10000) {
+        if (bank.value(0) < previous) monotonic = false;
+        previous = bank.value(0);
+        ++steps;
+    }
+    check(monotonic && steps > 1, "smoother glides monotonically", sampleRate);
+    check(bank.isSettled() && bank.value(0) == 1.0f, "smoother lands exactly on the target", sampleRate);
+    check(bank.value(1) == 0.25f, "settled lane is left alone", sampleRate);
+
+    const int numFrames = static_cast<int>(sampleRate / 2);
+    std::vector<float> in(numFrames), blockL(numFrames), blockR(numFrames), singleL(numFrames), singleR(numFrames);
+    for (int i = 0; i < numFrames; ++i) in[i] = std::sin(i * 0.05f) * 0.5f;
+
+    DeliVerbDSP block, single;
+    for (DeliVerbDSP* dsp : {&block, &single}) {
+        dsp->setSampleRate(sampleRate);
+        dsp->reset();
+        dsp->setParameter(DeliVerbDSP::kDelayMix, 0.9f);
+        dsp->setParameter(DeliVerbDSP::kDelayTime, 60.0f);
+    }
+    block.processStereo(in.data(), in.data(), blockL.data(), blockR.data(), numFrames);
+    for (int i = 0; i < numFrames; ++i) {
+        single.processStereo(&in[i], &in[i], &singleL[i], &singleR[i], 1);
+    }
+    check(blockL == singleL && blockR == singleR, "smoothed glide is independent of block size", sampleRate);
+
+    // Once settled, blocks run longer than a smoothing step; a change that
+    // arrives after that must still glide on the same grid
+    for (int pass = 0; pass < 3; ++pass) {
+        block.processStereo(in.data(), in.data(), blockL.data(), blockR.data(), numFrames);
+        for (int i = 0; i < numFrames; ++i) {
+            single.processStereo(&in[i], &in[i], &singleL[i], &singleR[i], 1);
+        }
+    }
+    const int changeAt = 1237; // Off the smoothing grid
+    block.processStereo(in.data(), in.data(), blockL.data(), blockR.data(), changeAt);
+    for (int i = 0; i < changeAt; ++i) {
+        single.processStereo(&in[i], &in[i], &singleL[i], &singleR[i], 1);
+    }
+    block.setParameter(DeliVerbDSP::kDelayMix, 0.3f);
+    single.setParameter(DeliVerbDSP::kDelayMix, 0.3f);
+    block.processStereo(&in[changeAt], &in[changeAt], &blockL[changeAt], &blockR[changeAt], numFrames - changeAt);
+    for (int i = changeAt; i < numFrames; ++i) {
+        single.processStereo(&in[i], &in[i], &singleL[i], &singleR[i], 1);
+    }
+    check(blockL == singleL && blockR == singleR, "glides after settling are independent of block size", sampleRate);
+}
+
+// A delay-time glide bends the pitch of what is already in the line: the
+// read point must move a little every sample, never jump. Largest sample
+// step of the output while the delay time glides 300 -> 1000 ms, against
+// the steepest a tone pitched up by the glide's fastest rate can move.
+void checkDelayTimeGlide(double sampleRate) {
+    const float frequency = 173.0f, amplitude = 0.25f;
+    const double twoPi = 6.283185307179586;
+    DeliVerbDSP dsp;
+    dsp.setSampleRate(sampleRate);
+    dsp.setParameter(DeliVerbDSP::kDelayTime, 300.0f);
+    dsp.setParameter(DeliVerbDSP::kDelayRepeat, 0.0f);
+    dsp.setParameter(DeliVerbDSP::kDelayMix, 1.0f);
+    dsp.setParameter(DeliVerbDSP::kReverbMix, 0.0f);
+    dsp.reset();
+
+    const int blockSize = 256;
+    std::vector<float> in(blockSize), outL(blockSize), outR(blockSize);
+    long long n = 0;
+    float previous = 0.0f;
+    auto render = [&](int numBlocks) {
+        float largestStep = 0.0f;
+        for (int b = 0; b < numBlocks; ++b) {
+            for (float& x : in) x = amplitude * static_cast<float>(std::sin(twoPi * frequency * n++ / sampleRate));
+            dsp.processStereo(in.data(), in.data(), outL.data(), outR.data(), blockSize);
+            for (float y : outL) {
+                largestStep = std::max(largestStep, std::abs(y - previous));
+                previous = y;
+            }
+        }
+        return largestStep;
+    };
+    const int second = static_cast<int>(sampleRate) / blockSize;
+    render(second); // Fill the line
+    dsp.setParameter(DeliVerbDSP::kDelayTime, 1000.0f);
+    const float glideStep = render(second);
+
+    // The 50 ms smoother moves the tap at most 700 ms / 50 ms = 14 samples
+    // per sample, so the delayed tone reads at up to 15x its pitch
+    const float dryBound = amplitude * static_cast<float>(twoPi * frequency / sampleRate);
+    const float bound = dryBound * (1.0f + 15.0f);
+    check(glideStep < bound, "delay-time glide has no jumps", sampleRate);
+}
+
+// The delay section runs as block passes over each render sub-block. Delays
+// shorter than a sub-block (below the 50 ms the host range allows, down to
+// the one-sample clamp) must still give exactly the per-sample result.
+void checkShortDelayBlocks(double sampleRate) {
+    const int numFrames = 4096;
+    std::vector<float> in(numFrames);
+    for (int i = 0; i < numFrames; ++i) in[i] = std::sin(i * 0.031f) * 0.5f + (i % 97 == 0 ? 0.4f : 0.0f);
+
+    bool matches = true;
+    for (float delayMs : {0.0f, 0.5f, 3.0f}) {
+        DeliVerbDSP block, single;
+        for (DeliVerbDSP* dsp : {&block, &single}) {
+            dsp->setSampleRate(sampleRate);
+            dsp->setParameter(DeliVerbDSP::kDelayTime, delayMs);
+            dsp->setParameter(DeliVerbDSP::kDelayRepeat, 0.7f);
+            dsp->setParameter(DeliVerbDSP::kDelayMix, 0.9f);
+            dsp->reset();
+        }
+        std::vector<float> blockL(numFrames), blockR(numFrames), singleL(numFrames), singleR(numFrames);
+        for (int i = 0; i < numFrames; i += 700) {
+            const int count = std::min(700, numFrames - i);
+            block.processStereo(&in[i], &in[i], &blockL[i], &blockR[i], count);
+        }
+        for (int i = 0; i < numFrames; ++i) {
+            single.processStereo(&in[i], &in[i], &singleL[i], &singleR[i], 1);
+        }
+        if (blockL != singleL || blockR != singleR) matches = false;
+
+        for (int i = 0; i < numFrames; i += 700) {
+            const int count = std::min(700, numFrames - i);
+            block.process(&in[i], &blockL[i], &blockR[i], count);
+        }
+        for (int i = 0; i < numFrames; ++i) {
+            single.process(&in[i], &singleL[i], &singleR[i], 1);
+        }
+        if (blockL != singleL || blockR != singleR) matches = false;
+    }
+    check(matches, "delays shorter than a render sub-block match per-sample rendering", sampleRate);
+}
+
+// Reverb::processBlock must match per-sample process() exactly: across
+// irregular block sizes, parameter changes, coefficient ramps mid-block
+// and combs shorter than processBlock()'s chunk
+void checkReverbBlocks(double sampleRate) {
+    Reverb block, single;
+    for (Reverb* reverb : {&block, &single}) {
+        reverb->setSampleRate(sampleRate);
+        reverb->setSize(0.0f);
+        reverb->setStyle(0.8f);
+    }
+    Reverb::Coefficients large;
+    Reverb::computeSize(large, 1.0f);
+    Reverb::computeStyle(large, 0.2f, sampleRate);
+    Reverb::computeLowCut(large, 300.0f, sampleRate);
+    Reverb::computeHighCut(large, 6000.0f, sampleRate);
+    Reverb::computeScoop(large, 0.5f, sampleRate);
+
+    const int numFrames = 16000;
+    std::vector<float> inL(numFrames), inR(numFrames);
+    for (int i = 0; i < numFrames; ++i) {
+        inL[i] = (i % 1500 == 0 ? 0.8f : 0.0f) + std::sin(i * 0.013f) * 0.1f;
+        inR[i] = (i % 1100 == 0 ? -0.6f : 0.0f);
+    }
+    std::vector<float> blockL(numFrames), blockR(numFrames), singleL(numFrames), singleR(numFrames);
+
+    int position = 0;
+    for (int n = 0; position < numFrames; ++n) {
+        const int count = std::min(numFrames - position, 1 + (n * 173) % 900);
+        if (n == 5) {
+            block.setSize(0.3f);
+            single.setSize(0.3f);
+        }
+        if (n == 9) {
+            block.rampTo(large, 700); // Ends inside a later block
+            single.rampTo(large, 700);
+        }
+        if (n == 16) {
+            // Combs shorter than a chunk, only reachable with a custom set
+            Reverb::Coefficients tiny = large;
+            for (int i = 0; i < Reverb::kNumComb; ++i) tiny.combDelays[i] = 0.2f + 0.1f * i;
+            block.setCoefficients(tiny);
+            single.setCoefficients(tiny);
+        }
+        block.processBlock(&inL[position], &inR[position], &blockL[position], &blockR[position], count);
+        for (int i = position; i < position + count; ++i) {
+            single.process(inL[i], inR[i], singleL[i], singleR[i]);
+        }
+        position += count;
+    }
+    check(blockL == singleL && blockR == singleR, "reverb block processing matches per-sample processing", sampleRate);
+}
+
+// Integer taps return exactly the sample written that long ago, fractional
+// taps interpolate with the full fraction however far the write index has
+// run, and out-of-range delays clamp to [1, maxDelaySamples()]
+void checkDelayLine() {
+    const double sampleRate = 48000.0;
+    DelayLine delay;
+    delay.setSampleRate(sampleRate);
+    delay.setMaxDelayMs(2100.0f);
+    const float maxDelay = delay.maxDelaySamples();
+    const size_t history = static_cast<size_t>(maxDelay) + 2;
+
+    // Distinct values so any off-by-one shows; several wraps of the buffer
+    auto sampleAt = [](size_t n) { return static_cast<float>(n * 7919 % 9973) / 9973.0f - 0.5f; };
+    const size_t written = 5 * history + 123;
+    for (size_t n = 0; n < written; ++n) delay.write(sampleAt(n));
+    auto ago = [&](size_t d) { return sampleAt(written - d); };
+
+    bool exact = true;
+    for (size_t d : {size_t{1}, size_t{2}, size_t{1000}, static_cast<size_t>(maxDelay)}) {
+        if (delay.tap(static_cast<float>(d)) != ago(d)) exact = false;
+    }
+    check(exact, "delay line integer taps are exact after wrapping", sampleRate);
+
+    bool interpolated = true;
+    for (float d : {1.3f, 4410.7f, 90000.1f}) {
+        const size_t whole = static_cast<size_t>(d);
+        const float frac = d - static_cast<float>(whole);
+        const float expected = ago(whole) * (1.0f - frac) + ago(whole + 1) * frac;
+        if (std::abs(delay.tap(d) - expected) > 1e-6f) interpolated = false;
+    }
+    check(interpolated, "delay line fractional taps keep the full fraction", sampleRate);
+
+    const bool clamped = delay.readSamples(0.0f) == ago(1)
+        && delay.readSamples(1.0e9f) == delay.tap(maxDelay)
+        && delay.read(1.0e6f) == delay.tap(maxDelay)
+        && delay.delaySamples(250.0f) == 12000.0f;
+    check(clamped, "delay line clamps out-of-range delays", sampleRate);
+}
+
+// Block reads and writes, fixed and per-sample delays, must match
+// interleaved tap()/write() exactly for every interpolation policy,
+// including blocks that straddle the end of the buffer; segments() must
+// expose the same samples as integer taps
+template<typename Interpolation>
+void checkDelayLineBlocks(const char* policy) {
+    const double sampleRate = 48000.0;
+    using Line = BasicDelayLine<Interpolation>;
+    Line perSample, blocks, modulated, modulatedBlocks;
+    for (Line* delay : {&perSample, &blocks, &modulated, &modulatedBlocks}) {
+        delay->setSampleRate(sampleRate);
+        delay->setMaxDelayMs(10.0f); // A few hundred samples, so it wraps often
+    }
+    const int kMaxBlock = 64;
+    const float kShortest = static_cast<float>(kMaxBlock + Interpolation::kNewer);
+    const float kFixedDelays[] = {100.37f, kShortest, 257.0f};
+
+    bool fixedMatches = true, variableMatches = true, segmentsMatch = true;
+    float input[kMaxBlock], expected[kMaxBlock], output[kMaxBlock], delays[kMaxBlock];
+    auto inputAt = [](int n) { return std::sin(n * 0.173f) * 0.8f + ((n * 7919) % 101) * 0.001f; };
+    int position = 0;
+    for (int block = 0; block < 400; ++block) {
+        const int numSamples = 1 + (block * 37) % kMaxBlock;
+        const float fixedDelay = kFixedDelays[block % 3];
+        for (int i = 0; i < numSamples; ++i, ++position) {
+            input[i] = inputAt(position);
+            delays[i] = 150.0f + 80.0f * std::sin(position * 0.011f);
+        }
+
+        for (int i = 0; i < numSamples; ++i) {
+            expected[i] = perSample.tap(fixedDelay);
+            perSample.write(input[i]);
+        }
+        blocks.readBlock(output, numSamples, fixedDelay);
+        blocks.writeBlock(input, numSamples);
+        if (!std::equal(output, output + numSamples, expected)) fixedMatches = false;
+
+        for (int i = 0; i < numSamples; ++i) {
+            expected[i] = modulated.tap(delays[i]);
+            modulated.write(input[i]);
+        }
+        modulatedBlocks.readBlock(output, numSamples, delays);
+        modulatedBlocks.writeBlock(input, numSamples);
+        if (!std::equal(output, output + numSamples, expected)) variableMatches = false;
+
+        const size_t delay = 300;
+        if (position < static_cast<int>(delay)) continue; // Still the silent start
+        const auto segments = blocks.segments(delay, kMaxBlock);
+        if (segments.first.size() + segments.second.size() != kMaxBlock) segmentsMatch = false;
+        for (int i = 0; i < kMaxBlock && segmentsMatch; ++i) {
+            const size_t first = segments.first.size();
+            const float sample = static_cast<size_t>(i) < first ? segments.first[i] : segments.second[i - first];
+            if (sample != inputAt(position - static_cast<int>(delay) + i)) segmentsMatch = false;
+        }
+    }
+    const std::string name = std::string(policy) + " delay line ";
+    check(fixedMatches, (name + "block reads match per-sample taps").c_str(), sampleRate);
+    check(variableMatches, (name + "per-sample-delay block reads match taps").c_str(), sampleRate);
+    check(segmentsMatch, (name + "segments match integer taps").c_str(), sampleRate);
+}
+
+// Worst error of a policy reading a sine at a fractional delay, against the
+// exact delayed sine
+template<typename Interpolation>
+double interpolationError(double sampleRate, double frequency, float delay) {
+    BasicDelayLine<Interpolation> line;
+    line.setSampleRate(sampleRate);
+    line.setMaxDelayMs(10.0f);
+    const double omega = 2.0 * M_PI * frequency / sampleRate;
+    double worst = 0.0;
+    for (int n = 0; n < 4000; ++n) {
+        const float out = line.tap(delay); // Read every sample, as the allpass needs
+        line.write(static_cast<float>(std::sin(omega * n)));
+        if (n > 2000) worst = std::max(worst, std::abs(out - std::sin(omega * (n - delay))));
+    }
+    return worst;
+}
+
+// Every fractional-delay policy is as accurate as documented: the error
+// bounds rank them, and tap4() matches tap() lane by lane
+void checkDelayInterpolation() {
+    const double sampleRate = 48000.0;
+    const float delay = 100.3f;
+    const double none = interpolationError<NoInterpolation>(sampleRate, 1000.0, delay);
+    const double linear = interpolationError<LinearInterpolation>(sampleRate, 1000.0, delay);
+    const double hermite = interpolationError<HermiteInterpolation>(sampleRate, 1000.0, delay);
+    const double lagrange = interpolationError<LagrangeInterpolation>(sampleRate, 1000.0, delay);
+    const double allpass = interpolationError<AllpassInterpolation>(sampleRate, 1000.0, delay);
+    const double noneRoundingUp = interpolationError<NoInterpolation>(sampleRate, 1000.0, delay + 0.4f);
+    check(none < 0.05 && noneRoundingUp < 0.05 && none > linear, "integer taps read the nearest sample", sampleRate);
+    check(linear < 3e-3, "linear interpolation is accurate at 1 kHz", sampleRate);
+    check(hermite < 1e-4 && lagrange < 1e-4, "four-point interpolation is accurate at 1 kHz", sampleRate);
+    check(allpass < 2e-4, "allpass interpolation is accurate at 1 kHz", sampleRate);
+
+    // tap4() must match four independent tap() calls; the allpass lanes
+    // each need their own line to keep their own state
+    bool lanesMatch = true;
+    auto compareLanes = [&lanesMatch, sampleRate](auto policy) {
+        using Line = BasicDelayLine<decltype(policy)>;
+        Line wide, single[4];
+        wide.setSampleRate(sampleRate);
+        wide.setMaxDelayMs(10.0f);
+        for (auto& line : single) {
+            line.setSampleRate(sampleRate);
+            line.setMaxDelayMs(10.0f);
+        }
+        const float delays[4] = {2.0f, 37.61f, 150.5f, 400.99f};
+        for (int n = 0; n < 3000; ++n) {
+            alignas(16) float lanes[4];
+            wide.tap4(delays).store(lanes);
+            const float input = std::sin(n * 0.37f) + 0.3f * std::sin(n * 2.1f);
+            for (int lane = 0; lane < 4; ++lane) {
+                if (lanes[lane] != single[lane].tap(delays[lane])) lanesMatch = false;
+                single[lane].write(input);
+            }
+            wide.write(input);
+        }
+    };
+    compareLanes(NoInterpolation{});
+    compareLanes(LinearInterpolation{});
+    compareLanes(HermiteInterpolation{});
+    compareLanes(LagrangeInterpolation{});
+    compareLanes(AllpassInterpolation{});
+    check(lanesMatch, "four-lane taps match scalar taps for every policy", sampleRate);
+}
+
+// Each lane of the multi-lane filter must match a scalar filter of the same
+// precision exactly, ramps included
+void checkMultiBiquad() {
+    const double sampleRate = 48000.0;
+    const auto from = Biquad::design(Biquad::Type::LowPass, 4000.0, 0.707, 0.0, sampleRate);
+    const auto to = Biquad::design(Biquad::Type::LowPass, 12000.0, 0.707, 0.0, sampleRate);
+
+    MultiBiquad<float, 16> lanes;
+    BasicBiquad<float> reference[16];
+    lanes.setCoefficients(from);
+    for (auto& filter : reference) filter.setCoefficients(from);
+
+    bool identical = true;
+    float samples[16];
+    for (int i = 0; i < 2048; ++i) {
+        if (i == 500) {
+            lanes.rampTo(to, 128);
+            for (auto& filter : reference) filter.rampTo(to, 128);
+        }
+        for (int n = 0; n < 16; ++n) samples[n] = std::sin(i * (0.01f + n * 0.013f)) * 0.6f;
+        float expected[16];
+        for (int n = 0; n < 16; ++n) expected[n] = reference[n].process(samples[n]);
+        lanes.process(samples);
+        for (int n = 0; n < 16; ++n) {
+            if (samples[n] != expected[n]) identical = false;
+        }
+    }
+    check(identical, "multi-lane float biquad matches scalar float biquads", sampleRate);
+}
+
+// Noise floor of float against double coefficients/state, on white noise.
+// The comb damping lowpass runs in float and must stay far below anything
+// audible; a low-frequency high-pass in float does not, which is why the
+// tone stacks stay double.
+void checkFilterPrecision(double sampleRate) {
+    const auto noise = Test::noiseBurst(1 << 16, 1 << 16);
+
+    auto floatSNR = [&](const Biquad::Coefficients& c) {
+        Biquad precise;
+        BasicBiquad<float> single;
+        precise.setCoefficients(c);
+        single.setCoefficients(c);
+        std::vector<float> reference(noise.size()), test(noise.size());
+        for (size_t i = 0; i < noise.size(); ++i) {
+            reference[i] = precise.process(noise[i]);
+            test[i] = single.process(noise[i]);
+        }
+        return Test::snrDB(reference, test);
+    };
+
+    const double dampingSNR = std::min(
+        floatSNR(Biquad::design(Biquad::Type::LowPass, 4000.0, 0.707, 0.0, sampleRate)),
+        floatSNR(Biquad::design(Biquad::Type::LowPass, 12000.0, 0.707, 0.0, sampleRate)));
+    const double lowCutSNR = floatSNR(Biquad::design(Biquad::Type::HighPass, 20.0, 0.707, 0.0, sampleRate));
+
+    check(dampingSNR > 100.0, "float comb damping noise floor below -100 dB", sampleRate);
+    check(lowCutSNR < dampingSNR - 30.0, "float low cut is markedly noisier than damping", sampleRate);
+}
+
+// Block (state-space) filtering against per-sample filtering, over uneven
+// block sizes and a coefficient ramp. In double the two agree to far below
+// float output resolution; in float the block path may round differently
+// but must not be noisier than per-sample float by more than a few dB.
+void checkBlockFiltering(double sampleRate) {
+    const auto noise = Test::noiseBurst(1 << 15, 1 << 15);
+    const int blockSizes[] = {512, 3, 7, 64, 1, 250};
+    const size_t rampAt = 20000;
+
+    auto perSample = [&](auto& filter, const Biquad::Coefficients& to) {
+        std::vector<float> out(noise.size());
+        for (size_t i = 0; i < noise.size(); ++i) {
+            if (i == rampAt) filter.rampTo(to, 100);
+            out[i] = filter.process(noise[i]);
+        }
+        return out;
+    };
+    auto perBlock = [&](auto& filter, const Biquad::Coefficients& to) {
+        std::vector<float> out = noise;
+        size_t i = 0;
+        for (int k = 0; i < out.size(); ++k) {
+            if (i == rampAt) filter.rampTo(to, 100);
+            size_t n = std::min<size_t>(blockSizes[k % 6], out.size() - i);
+            if (i < rampAt && i + n > rampAt) n = rampAt - i;
+            filter.processBlock(out.data() + i, static_cast<int>(n));
+            i += n;
+        }
+        return out;
+    };
+
+    const std::pair<Biquad::Coefficients, Biquad::Coefficients> cases[] = {
+        {Biquad::design(Biquad::Type::LowPass, 1000.0, 0.707, 0.0, sampleRate),
+         Biquad::design(Biquad::Type::LowPass, 3000.0, 0.707, 0.0, sampleRate)},
+        {Biquad::design(Biquad::Type::HighPass, 30.0, 0.707, 0.0, sampleRate),
+         Biquad::design(Biquad::Type::HighPass, 60.0, 0.707, 0.0, sampleRate)},
+        {Biquad::design(Biquad::Type::Peak, 500.0, 4.0, 12.0, sampleRate),
+         Biquad::design(Biquad::Type::Peak, 800.0, 4.0, -12.0, sampleRate)},
+    };
+    bool doubleMatches = true;
+    bool floatMatches = true;
+    for (const auto& [from, to] : cases) {
+        Biquad sampleFilter, blockFilter;
+        BasicBiquad<float> floatSampleFilter, floatBlockFilter;
+        sampleFilter.setCoefficients(from);
+        blockFilter.setCoefficients(from);
+        floatSampleFilter.setCoefficients(from);
+        floatBlockFilter.setCoefficients(from);
+
+        const auto reference = perSample(sampleFilter, to);
+        if (Test::snrDB(reference, perBlock(blockFilter, to)) < 150.0) doubleMatches = false;
+
+        const double sampleSNR = Test::snrDB(reference, perSample(floatSampleFilter, to));
+        const double blockSNR = Test::snrDB(reference, perBlock(floatBlockFilter, to));
+        if (blockSNR < sampleSNR - 6.0) floatMatches = false;
+    }
+    check(doubleMatches, "double block filtering matches per-sample", sampleRate);
+    check(floatMatches, "float block filtering is as clean as per-sample", sampleRate);
+}
+
+// The TPT state-variable filter has the same bilinear responses as the RBJ
+// biquads, and stays bounded when its cutoff and resonance jump every sample
+void checkStateVariableFilter(double sampleRate) {
+    using SVF = StateVariableFilter;
+    struct Case { Biquad::Type biquad; SVF::Type svf; float frequency, Q, gainDB; };
+    const Case cases[] = {
+        {Biquad::Type::LowPass,  SVF::Type::LowPass,  1000.0f,  0.707f, 0.0f},
+        {Biquad::Type::LowPass,  SVF::Type::LowPass,  18000.0f, 0.707f, 0.0f},
+        {Biquad::Type::HighPass, SVF::Type::HighPass, 20.0f,    0.707f, 0.0f},
+        {Biquad::Type::BandPass, SVF::Type::BandPass, 2000.0f,  2.0f,   0.0f},
+        {Biquad::Type::Notch,    SVF::Type::Notch,    2000.0f,  2.0f,   0.0f},
+        {Biquad::Type::AllPass,  SVF::Type::AllPass,  2000.0f,  0.7f,   0.0f},
+        {Biquad::Type::Peak,     SVF::Type::Peak,     500.0f,   0.7f,   -12.0f},
+        {Biquad::Type::Peak,     SVF::Type::Peak,     3000.0f,  3.0f,   9.0f},
+    };
+    const auto noise = Test::noiseBurst(1 << 15, 1 << 15);
+
+    bool matches = true;
+    for (const auto& c : cases) {
+        Biquad biquad;
+        biquad.setCoefficients(Biquad::design(c.biquad, c.frequency, c.Q, c.gainDB, sampleRate));
+        SVF svf;
+        svf.setSampleRate(sampleRate);
+        svf.setType(c.svf);
+        svf.setResonance(c.Q);
+        svf.setGainDB(c.gainDB);
+        svf.setCutoff(c.frequency);
+
+        std::vector<float> reference(noise.size()), test(noise.size());
+        for (size_t i = 0; i < noise.size(); ++i) {
+            reference[i] = biquad.process(noise[i]);
+            test[i] = svf.process(noise[i]);
+        }
+        if (Test::snrDB(reference, test) < 100.0) matches = false;
+    }
+    check(matches, "state-variable filter matches the biquad responses", sampleRate);
+
+    // Cutoff anywhere from 20 Hz to past Nyquist and Q up to 20, every sample
+    SVF svf;
+    svf.setSampleRate(sampleRate);
+    svf.setType(SVF::Type::LowPass);
+    uint32_t state = 12345;
+    auto random = [&state] {
+        state = state * 1664525u + 1013904223u;
+        return static_cast<float>(state >> 8) / 16777216.0f;
+    };
+    float peak = 0.0f;
+    for (size_t i = 0; i < noise.size(); ++i) {
+        svf.setCutoff(20.0f * std::pow(1200.0f, random()));
+        svf.setResonance(0.5f + 19.5f * random());
+        const float out = svf.process(noise[i]);
+        if (!std::isfinite(out)) peak = INFINITY;
+        peak = std::max(peak, std::abs(out));
+    }
+    check(peak < 50.0f, "state-variable filter is stable under per-sample modulation", sampleRate);
+}
+
+// A ramp moves every coefficient monotonically and lands exactly on target
+void checkCoefficientRamps() {
+    const double sampleRate = 48000.0;
+    const auto from = Biquad::design(Biquad::Type::LowPass, 200.0, 0.707, 0.0, sampleRate);
+    const auto to = Biquad::design(Biquad::Type::LowPass, 8000.0, 0.707, 0.0, sampleRate);
+
+    Biquad filter;
+    filter.setCoefficients(from);
+    filter.rampTo(to, 64);
+
+    bool monotonic = true;
+    double previousA1 = from.a1;
+    for (int i = 0; i < 64; ++i) {
+        filter.process(0.5f);
+        const double a1 = filter.coefficients().a1;
+        if ((to.a1 > from.a1) ? a1 < previousA1 : a1 > previousA1) monotonic = false;
+        previousA1 = a1;
+    }
+    const auto landed = filter.coefficients();
+    check(monotonic, "biquad ramp is monotonic", sampleRate);
+    check(!filter.isRamping() && landed.b0 == to.b0 && landed.a1 == to.a1 && landed.a2 == to.a2,
+          "biquad ramp lands exactly on the target", sampleRate);
+
+    // Blocks of one sample switch immediately
+    filter.rampTo(from, 1);
+    check(!filter.isRamping() && filter.coefficients().a1 == from.a1, "one-sample ramp is a step", sampleRate);
+}
+
+// The SIMD stereo pair must match two scalar biquads exactly, ramps included
+void checkStereoBiquad() {
+    const double sampleRate = 48000.0;
+    const auto from = Biquad::design(Biquad::Type::HighPass, 120.0, 0.707, 0.0, sampleRate);
+    const auto to = Biquad::design(Biquad::Type::Peak, 500.0, 0.7, -9.0, sampleRate);
+
+    Biquad left, right;
+    StereoBiquad pair;
+    left.setCoefficients(from);
+    right.setCoefficients(from);
+    pair.setCoefficients(from);
+
+    bool identical = true;
+    for (int i = 0; i < 4096; ++i) {
+        if (i == 1000) {
+            left.rampTo(to, 300);
+            right.rampTo(to, 300);
+            pair.rampTo(to, 300);
+        }
+        const float inL = std::sin(i * 0.031f) * 0.8f;
+        const float inR = (i % 7 == 0) ? 1.0f : std::cos(i * 0.17f) * 0.3f;
+        float outL = inL, outR = inR;
+        pair.process(outL, outR);
+        if (outL != left.process(inL) || outR != right.process(inR)) identical = false;
+    }
+    check(identical, "stereo biquad matches two scalar biquads", sampleRate);
+}
+
+// The fused cascade, per sample and per block, must match the same stages
+// run as separate pairs, including while a 0 dB scoop drains and is skipped
+void checkBiquadCascade() {
+    const double sampleRate = 48000.0;
+    const auto lowCut = Biquad::design(Biquad::Type::HighPass, 90.0, 0.707, 0.0, sampleRate);
+    const auto highCut = Biquad::design(Biquad::Type::LowPass, 7000.0, 0.707, 0.0, sampleRate);
+    const auto scoop = Biquad::design(Biquad::Type::Peak, 500.0, 0.7, -12.0, sampleRate);
+    const auto flat = Biquad::design(Biquad::Type::Peak, 500.0, 0.7, 0.0, sampleRate);
+
+    StereoBiquad separate[3];
+    StereoBiquadCascade<3> perSample, perBlock;
+    for (StereoBiquadCascade<3>* cascade : {&perSample, &perBlock}) {
+        cascade->setCoefficients(0, lowCut);
+        cascade->setCoefficients(1, highCut);
+        cascade->setCoefficients(2, flat);
+    }
+    separate[0].setCoefficients(lowCut);
+    separate[1].setCoefficients(highCut);
+    separate[2].setCoefficients(flat);
+    check(perSample.activeStages() == 2, "unity stage is skipped", sampleRate);
+
+    // Block sizes shorter than the pipeline included
+    const int blockSizes[] = {64, 1, 2, 37};
+    const int numBlocks = 240;
+    bool identical = true;
+    std::vector<float> blockL(64), blockR(64);
+    int n = 0;
+    for (int b = 0; b < numBlocks; ++b) {
+        const int blockSize = blockSizes[b % 4];
+        // Scoop in, then back out to 0 dB; silence at the end lets it drain
+        if (b == 12 || b == 60) {
+            const auto& target = b == 12 ? scoop : flat;
+            separate[2].rampTo(target, blockSize);
+            perSample.rampTo(2, target, blockSize);
+            perBlock.rampTo(2, target, blockSize);
+        }
+        auto inputL = [&](int k) { return b < 180 ? std::sin(k * 0.013f) * 0.7f : 0.0f; };
+        auto inputR = [&](int k) { return b < 180 ? std::sin(k * 0.021f) * 0.4f : 0.0f; };
+        for (int i = 0; i < blockSize; ++i) {
+            blockL[i] = inputL(n + i);
+            blockR[i] = inputR(n + i);
+        }
+        perBlock.processBlock(blockL.data(), blockR.data(), blockSize);
+        for (int i = 0; i < blockSize; ++i, ++n) {
+            float refL = inputL(n), refR = inputR(n);
+            for (auto& stage : separate) stage.process(refL, refR);
+            float outL = inputL(n), outR = inputR(n);
+            perSample.process(outL, outR);
+            if (outL != refL || outR != refR || blockL[i] != refL || blockR[i] != refR) identical = false;
+        }
+    }
+    check(identical, "biquad cascade matches separate stages", sampleRate);
+    check(perSample.activeStages() == 2 && perBlock.activeStages() == 2,
+          "flat scoop is skipped again once drained", sampleRate);
+}
+
+} // namespace
+
+int main() {
+    checkCoefficientRamps();
+    checkStereoBiquad();
+    checkBiquadCascade();
+    checkMultiBiquad();
+    checkSmoothers();
+    checkDelayLine();
+    checkDelayLineBlocks<NoInterpolation>("nearest");
+    checkDelayLineBlocks<LinearInterpolation>("linear");
+    checkDelayLineBlocks<HermiteInterpolation>("Hermite");
+    checkDelayLineBlocks<LagrangeInterpolation>("Lagrange");
+    checkDelayLineBlocks<AllpassInterpolation>("allpass");
+    checkDelayInterpolation();
+
+    for (double sampleRate : {44100.0, 48000.0, 96000.0, 192000.0}) {
+        runAtSampleRate(sampleRate);
+        checkIncrementalUpdates(sampleRate);
+        checkShortDelayBlocks(sampleRate);
+        checkDelayTimeGlide(sampleRate);
+        checkReverbBlocks(sampleRate);
+        checkFilterPrecision(sampleRate);
+        checkBlockFiltering(sampleRate);
+        checkStateVariableFilter(sampleRate);
+    }
+
+    if (g_failures > 0) {
+        std::fprintf(stderr, "%d check(s) failed\n", g_failures);
+        return 1;
+    }
+
+    std::printf("DSP smoke test passed\n");
+    return 0;
+}
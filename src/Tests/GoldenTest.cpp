@@ -0,0 +1,223 @@
+// Golden-output regression harness.
+//
+// Renders fixed stimuli through DeliVerbDSP and compares them with outputs
+// recorded from the reference scalar engine, using max-abs error, SNR and
+// log-spectral distance. Optimized kernels must stay within tolerance.
+//
+// Usage: deliverb_golden_test --check DIR   (default)
+//        deliverb_golden_test --record DIR  (rewrite the golden files)
+//        [--max-abs E] [--min-snr DB] [--max-spectral DB] [--filter NAME]
+
+#include "AudioCompare.h"
+#include "Presets.h"
+#include "TestSignals.h"
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <vector>
+
+using namespace DeliVerb;
+using namespace DeliVerb::Test;
+
+namespace {
+
+constexpr double kSampleRate = 44100.0;
+constexpr size_t kNumFrames = 16384;
+
+// Irregular host block sizes so sub-block boundaries move around
+constexpr int kBlockPattern[] = {128, 37, 512, 1, 256, 64};
+
+constexpr char kMagic[8] = {'D', 'V', 'G', 'O', 'L', 'D', '0', '1'};
+
+enum class Signal { Impulse, Sweep, NoiseBurst, SilenceTail };
+
+struct GoldenCase {
+    const char* name;
+    const char* preset;
+    Signal signal;
+    bool stereo;
+};
+
+const GoldenCase kCases[] = {
+    {"classic_impulse",           "Classic",      Signal::Impulse,     true},
+    {"classic_sweep",             "Classic",      Signal::Sweep,       true},
+    {"classic_noise_burst",       "Classic",      Signal::NoiseBurst,  true},
+    {"classic_silence_tail",      "Classic",      Signal::SilenceTail, true},
+    {"atmospheric_impulse",       "Atmospheric",  Signal::Impulse,     true},
+    {"atmospheric_sweep",         "Atmospheric",  Signal::Sweep,       true},
+    {"atmospheric_noise_burst",   "Atmospheric",  Signal::NoiseBurst,  true},
+    {"atmospheric_silence_tail",  "Atmospheric",  Signal::SilenceTail, true},
+    {"allfilters_sweep",          "AllFilters",   Signal::Sweep,       true},
+    {"heavyducking_noise_burst",  "HeavyDucking", Signal::NoiseBurst,  true},
+    {"classic_impulse_mono",      "Classic",      Signal::Impulse,     false},
+    {"atmospheric_sweep_mono",    "Atmospheric",  Signal::Sweep,       false},
+};
+
+struct Tolerance {
+    double maxAbs = 2.0e-4;
+    double minSNR = 70.0;
+    double maxSpectral = 0.25;
+};
+
+std::vector<float> makeSignal(Signal signal) {
+    switch (signal) {
+        case Signal::Impulse:     return impulse(kNumFrames);
+        case Signal::Sweep:       return sineSweep(kNumFrames, kSampleRate);
+        case Signal::NoiseBurst:  return noiseBurst(kNumFrames, 2048);
+        case Signal::SilenceTail: return silenceTail(kNumFrames, kSampleRate, 1024);
+    }
+    return {};
+}
+
+// Renders a case and returns interleaved stereo output
+std::vector<float> render(const GoldenCase& testCase) {
+    const std::vector<float> inputL = makeSignal(testCase.signal);
+    std::vector<float> inputR(inputL.size());
+    for (size_t i = 0; i < inputL.size(); ++i) inputR[i] = -0.8f * inputL[i];
+
+    DeliVerbDSP dsp;
+    dsp.setSampleRate(kSampleRate);
+    Bench::findPreset(testCase.preset)->applyTo(dsp);
+    dsp.reset();
+
+    std::vector<float> outL(kNumFrames), outR(kNumFrames);
+    size_t pos = 0;
+    for (size_t block = 0; pos < kNumFrames; ++block) {
+        const int blockSize = kBlockPattern[block % std::size(kBlockPattern)];
+        const int count = static_cast<int>(std::min<size_t>(blockSize, kNumFrames - pos));
+        if (testCase.stereo) {
+            dsp.processStereo(inputL.data() + pos, inputR.data() + pos, outL.data() + pos, outR.data() + pos, count);
+        } else {
+            dsp.process(inputL.data() + pos, outL.data() + pos, outR.data() + pos, count);
+        }
+        pos += static_cast<size_t>(count);
+    }
+
+    std::vector<float> interleaved(kNumFrames * 2);
+    for (size_t i = 0; i < kNumFrames; ++i) {
+        interleaved[2 * i] = outL[i];
+        interleaved[2 * i + 1] = outR[i];
+    }
+    return interleaved;
+}
+
+std::string goldenPath(const std::string& dir, const GoldenCase& testCase) {
+    return dir + "/" + testCase.name + ".f32";
+}
+
+// Format: 8-byte magic, uint32 sample rate, uint32 channels, uint32 frames,
+// then interleaved little-endian float32 samples
+bool writeGolden(const std::string& path, const std::vector<float>& samples) {
+    FILE* file = std::fopen(path.c_str(), "wb");
+    if (!file) return false;
+    const uint32_t header[3] = {static_cast<uint32_t>(kSampleRate), 2u, static_cast<uint32_t>(kNumFrames)};
+    bool ok = std::fwrite(kMagic, sizeof(kMagic), 1, file) == 1;
+    ok = ok && std::fwrite(header, sizeof(header), 1, file) == 1;
+    ok = ok && std::fwrite(samples.data(), sizeof(float), samples.size(), file) == samples.size();
+    std::fclose(file);
+    return ok;
+}
+
+bool readGolden(const std::string& path, std::vector<float>& samples) {
+    FILE* file = std::fopen(path.c_str(), "rb");
+    if (!file) return false;
+    char magic[8];
+    uint32_t header[3];
+    bool ok = std::fread(magic, sizeof(magic), 1, file) == 1 && std::memcmp(magic, kMagic, sizeof(kMagic)) == 0;
+    ok = ok && std::fread(header, sizeof(header), 1, file) == 1;
+    ok = ok && header[0] == static_cast<uint32_t>(kSampleRate) && header[1] == 2u && header[2] == kNumFrames;
+    if (ok) {
+        samples.resize(static_cast<size_t>(header[1]) * header[2]);
+        ok = std::fread(samples.data(), sizeof(float), samples.size(), file) == samples.size();
+    }
+    std::fclose(file);
+    return ok;
+}
+
+std::vector<float> channel(const std::vector<float>& interleaved, size_t index) {
+    std::vector<float> result(interleaved.size() / 2);
+    for (size_t i = 0; i < result.size(); ++i) result[i] = interleaved[2 * i + index];
+    return result;
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    std::string dir;
+    bool record = false;
+    const char* filter = nullptr;
+    Tolerance tolerance;
+
+    for (int i = 1; i < argc; ++i) {
+        const std::string arg = argv[i];
+        const bool hasValue = i + 1 < argc;
+        if ((arg == "--check" || arg == "--record") && hasValue) {
+            record = arg == "--record";
+            dir = argv[++i];
+        } else if (arg == "--max-abs" && hasValue) {
+            tolerance.maxAbs = std::atof(argv[++i]);
+        } else if (arg == "--min-snr" && hasValue) {
+            tolerance.minSNR = std::atof(argv[++i]);
+        } else if (arg == "--max-spectral" && hasValue) {
+            tolerance.maxSpectral = std::atof(argv[++i]);
+        } else if (arg == "--filter" && hasValue) {
+            filter = argv[++i];
+        } else {
+            std::fprintf(stderr, "usage: %s --check|--record DIR [--max-abs E] [--min-snr DB] "
+                                 "[--max-spectral DB] [--filter NAME]\n", argv[0]);
+            return 2;
+        }
+    }
+    if (dir.empty()) {
+        std::fprintf(stderr, "%s: golden directory required (--check DIR or --record DIR)\n", argv[0]);
+        return 2;
+    }
+
+    int failures = 0;
+    for (const GoldenCase& testCase : kCases) {
+        if (filter && !std::strstr(testCase.name, filter)) continue;
+
+        const std::vector<float> output = render(testCase);
+        const std::string path = goldenPath(dir, testCase);
+
+        if (record) {
+            if (!writeGolden(path, output)) {
+                std::fprintf(stderr, "FAIL %s: cannot write %s\n", testCase.name, path.c_str());
+                ++failures;
+            } else {
+                std::printf("recorded %s\n", path.c_str());
+            }
+            continue;
+        }
+
+        std::vector<float> golden;
+        if (!readGolden(path, golden)) {
+            std::fprintf(stderr, "FAIL %s: cannot read %s\n", testCase.name, path.c_str());
+            ++failures;
+            continue;
+        }
+
+        double worstAbs = 0.0, worstSNR = std::numeric_limits<double>::infinity(), worstSpectral = 0.0;
+        for (size_t ch = 0; ch < 2; ++ch) {
+            const std::vector<float> ref = channel(golden, ch);
+            const std::vector<float> test = channel(output, ch);
+            worstAbs = std::max(worstAbs, maxAbsError(ref, test));
+            worstSNR = std::min(worstSNR, snrDB(ref, test));
+            worstSpectral = std::max(worstSpectral, spectralDistanceDB(ref, test));
+        }
+
+        const bool pass = worstAbs <= tolerance.maxAbs && worstSNR >= tolerance.minSNR
+                          && worstSpectral <= tolerance.maxSpectral;
+        std::printf("%s %-26s max-abs %.3g  snr %6.1f dB  spectral %.4f dB\n",
+                    pass ? "ok  " : "FAIL", testCase.name, worstAbs, worstSNR, worstSpectral);
+        if (!pass) ++failures;
+    }
+
+    if (failures > 0) {
+        std::fprintf(stderr, "%d golden case(s) failed\n", failures);
+        return 1;
+    }
+    return 0;
+}
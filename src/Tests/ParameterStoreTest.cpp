@@ -0,0 +1,180 @@
+// Parameter handoff test: host/UI threads automate every parameter (building
+// and publishing coefficient sets) while the render thread processes blocks
+// and a third thread reads values back (run under TSan with
+// -DDELIVERB_ENABLE_TSAN=ON to check the handoff is race-free). Afterwards the
+// engine must be running with exactly the last values written.
+
+#include "DeliVerbDSP.h"
+#include "ParameterStore.h"
+#include "TripleBuffer.h"
+
+#include <atomic>
+#include <cstdio>
+#include <thread>
+#include <vector>
+
+using namespace DeliVerb;
+
+namespace {
+
+int g_failures = 0;
+
+void check(bool condition, const char* what) {
+    if (!condition) {
+        std::fprintf(stderr, "FAIL: %s\n", what);
+        ++g_failures;
+    }
+}
+
+// Automation value for a parameter at a given step, inside its legal range
+float automationValue(int param, int step) {
+    static constexpr float kMin[DeliVerbDSP::kNumParams] = {
+        50.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 20.0f, 1000.0f, 0.0f, 20.0f, 1000.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f};
+    static constexpr float kMax[DeliVerbDSP::kNumParams] = {
+        2000.0f, 0.95f, 1.0f, 1.0f, 1.0f, 1.0f, 2000.0f, 20000.0f, 1.0f, 2000.0f, 20000.0f, 1.0f, 1.0f, 1.0f, 1.0f, 1.0f};
+    const float phase = static_cast<float>((step * 7 + param * 3) % 101) / 100.0f;
+    return kMin[param] + phase * (kMax[param] - kMin[param]);
+}
+
+void checkStoreReportsEveryChange() {
+    ParameterStore<8> store;
+    int seen[8] = {};
+    store.consume([&](int index, float) { ++seen[index]; });
+    check(seen[0] == 0, "fresh store reports nothing");
+
+    store.set(1, 0.5f);
+    store.set(6, 2.0f);
+    store.set(6, 3.0f);
+    float last6 = 0.0f;
+    store.consume([&](int index, float value) {
+        ++seen[index];
+        if (index == 6) last6 = value;
+    });
+    check(seen[1] == 1 && seen[6] == 1, "each changed parameter is reported once per consume");
+    check(last6 == 3.0f && store.get(6) == 3.0f, "consume hands over the latest value");
+
+    int again = 0;
+    store.consume([&](int, float) { ++again; });
+    check(again == 0, "consumed changes are not reported again");
+}
+
+// The reader only ever sees complete, increasingly recent values
+void checkTripleBufferHandsOverWholeValues() {
+    struct Payload {
+        int sequence = 0;
+        int copies[15] = {};
+    };
+    constexpr int kNumPublishes = 20000;
+
+    TripleBuffer<Payload> buffer;
+    std::atomic<bool> writing{true};
+    int torn = 0, backwards = 0, lastSeen = 0;
+
+    std::thread writer([&] {
+        for (int i = 1; i <= kNumPublishes; ++i) {
+            Payload& slot = buffer.back();
+            slot.sequence = i;
+            for (int& copy : slot.copies) copy = i;
+            buffer.publish();
+        }
+        writing.store(false, std::memory_order_release);
+    });
+
+    auto read = [&] {
+        if (!buffer.update()) return;
+        const Payload& value = buffer.front();
+        for (int copy : value.copies) {
+            if (copy != value.sequence) ++torn;
+        }
+        if (value.sequence <= lastSeen) ++backwards;
+        lastSeen = value.sequence;
+    };
+    while (writing.load(std::memory_order_acquire)) read();
+    writer.join();
+    read();
+
+    check(torn == 0, "triple buffer never hands over a partly written value");
+    check(backwards == 0, "triple buffer never goes back to an older value");
+    check(lastSeen == kNumPublishes, "triple buffer ends on the last published value");
+}
+
+} // namespace
+
+int main() {
+    checkStoreReportsEveryChange();
+    checkTripleBufferHandsOverWholeValues();
+
+    constexpr int kBlockSize = 64;
+    constexpr int kNumSteps = 2000;
+    constexpr double kSampleRate = 48000.0;
+
+    DeliVerbDSP dsp;
+    dsp.setSampleRate(kSampleRate);
+    dsp.reset();
+
+    std::vector<float> input(kBlockSize, 0.1f), outL(kBlockSize), outR(kBlockSize);
+    std::atomic<int> writersDone{0};
+    std::atomic<bool> outOfRange{false};
+
+    // Two writers split the parameters, like a host automating some while the UI moves others
+    auto writer = [&](int firstParam) {
+        for (int step = 0; step < kNumSteps; ++step) {
+            for (int p = firstParam; p < DeliVerbDSP::kNumParams; p += 2) {
+                dsp.setParameter(static_cast<DeliVerbDSP::ParamID>(p), automationValue(p, step));
+            }
+        }
+        writersDone.fetch_add(1, std::memory_order_release);
+    };
+
+    std::thread reader([&] {
+        while (writersDone.load(std::memory_order_acquire) < 2) {
+            const float delayTime = dsp.getParameter(DeliVerbDSP::kDelayTime);
+            if (delayTime < 50.0f || delayTime > 2000.0f) outOfRange.store(true);
+        }
+    });
+
+    std::thread renderThread([&] {
+        while (writersDone.load(std::memory_order_acquire) < 2) {
+            dsp.processStereo(input.data(), input.data(), outL.data(), outR.data(), kBlockSize);
+        }
+        // One more block picks up whatever was written last
+        dsp.processStereo(input.data(), input.data(), outL.data(), outR.data(), kBlockSize);
+    });
+
+    std::thread writerA(writer, 0);
+    std::thread writerB(writer, 1);
+    writerA.join();
+    writerB.join();
+    renderThread.join();
+    reader.join();
+
+    check(!outOfRange.load(), "readers only ever see written values");
+    for (int p = 0; p < DeliVerbDSP::kNumParams; ++p) {
+        const float expected = automationValue(p, kNumSteps - 1);
+        const float value = dsp.getParameter(static_cast<DeliVerbDSP::ParamID>(p));
+        check(value == (p == DeliVerbDSP::kAdvanced ? (expected > 0.5f ? 1.0f : 0.0f) : expected),
+              "getParameter returns the last value written");
+    }
+
+    // The render state must match an instance configured with the final values directly
+    const int numFrames = static_cast<int>(kSampleRate / 4);
+    std::vector<float> impulse(numFrames, 0.0f);
+    impulse[0] = 1.0f;
+    std::vector<float> refL(numFrames), refR(numFrames), testL(numFrames), testR(numFrames);
+
+    DeliVerbDSP reference;
+    for (int p = 0; p < DeliVerbDSP::kNumParams; ++p) {
+        reference.setParameter(static_cast<DeliVerbDSP::ParamID>(p), automationValue(p, kNumSteps - 1));
+    }
+    reference.setSampleRate(kSampleRate);
+    reference.reset();
+    reference.processStereo(impulse.data(), impulse.data(), refL.data(), refR.data(), numFrames);
+
+    dsp.reset();
+    dsp.processStereo(impulse.data(), impulse.data(), testL.data(), testR.data(), numFrames);
+    check(refL == testL && refR == testR, "render thread applied the final automation values");
+
+    if (g_failures > 0) return 1;
+    std::printf("parameter handoff test passed\n");
+    return 0;
+}
@@ -0,0 +1,185 @@
+// Interposers backing RealtimeScope. Linked only into test executables.
+
+#include "RealtimeGuard.h"
+
+#include <atomic>
+#include <cstddef>
+#include <new>
+
+#if defined(__linux__) && defined(__GLIBC__)
+#define DELIVERB_RT_GUARD 1
+#include <dlfcn.h>
+#include <pthread.h>
+#else
+#define DELIVERB_RT_GUARD 0
+#endif
+
+namespace DeliVerb::Test {
+
+namespace {
+
+thread_local int t_scopeDepth = 0;
+thread_local const char* t_entryPoint = nullptr;
+
+std::atomic<uint64_t> g_counts[static_cast<int>(Violation::kCount)];
+std::atomic<const char*> g_firstEntryPoint{nullptr};
+std::atomic<int> g_firstViolation{0};
+
+inline void noteViolation(Violation violation) {
+    if (t_scopeDepth == 0) return;
+    g_counts[static_cast<int>(violation)].fetch_add(1, std::memory_order_relaxed);
+    const char* expected = nullptr;
+    if (g_firstEntryPoint.compare_exchange_strong(expected, t_entryPoint)) {
+        g_firstViolation.store(static_cast<int>(violation), std::memory_order_relaxed);
+    }
+}
+
+} // namespace
+
+const char* violationName(Violation violation) {
+    switch (violation) {
+        case Violation::Malloc:         return "malloc";
+        case Violation::Free:           return "free";
+        case Violation::OperatorNew:    return "operator new";
+        case Violation::OperatorDelete: return "operator delete";
+        case Violation::MutexLock:      return "pthread_mutex_lock";
+        default:                        return "unknown";
+    }
+}
+
+RealtimeScope::RealtimeScope(const char* entryPoint) {
+    if (t_scopeDepth++ == 0) t_entryPoint = entryPoint;
+}
+
+RealtimeScope::~RealtimeScope() {
+    if (--t_scopeDepth == 0) t_entryPoint = nullptr;
+}
+
+ViolationReport violationReport() {
+    ViolationReport report;
+    for (int i = 0; i < static_cast<int>(Violation::kCount); ++i) {
+        report.counts[i] = g_counts[i].load(std::memory_order_relaxed);
+    }
+    report.firstEntryPoint = g_firstEntryPoint.load();
+    report.firstViolation = static_cast<Violation>(g_firstViolation.load(std::memory_order_relaxed));
+    return report;
+}
+
+void resetViolations() {
+    for (auto& count : g_counts) count.store(0, std::memory_order_relaxed);
+    g_firstEntryPoint.store(nullptr);
+}
+
+bool realtimeGuardAvailable() {
+    return DELIVERB_RT_GUARD != 0;
+}
+
+} // namespace DeliVerb::Test
+
+#if DELIVERB_RT_GUARD
+
+using DeliVerb::Test::Violation;
+using DeliVerb::Test::noteViolation;
+
+extern "C" {
+
+void* __libc_malloc(size_t size);
+void* __libc_calloc(size_t count, size_t size);
+void* __libc_realloc(void* ptr, size_t size);
+void* __libc_memalign(size_t alignment, size_t size);
+void __libc_free(void* ptr);
+
+void* malloc(size_t size) {
+    noteViolation(Violation::Malloc);
+    return __libc_malloc(size);
+}
+
+void* calloc(size_t count, size_t size) {
+    noteViolation(Violation::Malloc);
+    return __libc_calloc(count, size);
+}
+
+void* realloc(void* ptr, size_t size) {
+    noteViolation(Violation::Malloc);
+    return __libc_realloc(ptr, size);
+}
+
+void* aligned_alloc(size_t alignment, size_t size) {
+    noteViolation(Violation::Malloc);
+    return __libc_memalign(alignment, size);
+}
+
+int posix_memalign(void** result, size_t alignment, size_t size) {
+    noteViolation(Violation::Malloc);
+    void* ptr = __libc_memalign(alignment, size);
+    if (!ptr) return 12; // ENOMEM
+    *result = ptr;
+    return 0;
+}
+
+void free(void* ptr) {
+    if (ptr) noteViolation(Violation::Free);
+    __libc_free(ptr);
+}
+
+// Resolved before main so the first locked call never goes through dlsym
+static int (*s_realMutexLock)(pthread_mutex_t*) = nullptr;
+
+__attribute__((constructor)) static void resolveMutexLock() {
+    s_realMutexLock = reinterpret_cast<int (*)(pthread_mutex_t*)>(dlsym(RTLD_NEXT, "pthread_mutex_lock"));
+}
+
+int pthread_mutex_lock(pthread_mutex_t* mutex) {
+    noteViolation(Violation::MutexLock);
+    if (!s_realMutexLock) resolveMutexLock();
+    return s_realMutexLock(mutex);
+}
+
+} // extern "C"
+
+// Global operator new/delete, reported separately from the C allocator
+
+static void* allocate(size_t size, size_t alignment = 0) {
+    noteViolation(Violation::OperatorNew);
+    if (size == 0) size = 1;
+    return alignment > alignof(std::max_align_t) ? __libc_memalign(alignment, size) : __libc_malloc(size);
+}
+
+static void deallocate(void* ptr) {
+    if (ptr) noteViolation(Violation::OperatorDelete);
+    __libc_free(ptr);
+}
+
+void* operator new(size_t size) {
+    if (void* ptr = allocate(size)) return ptr;
+    throw std::bad_alloc();
+}
+
+void* operator new[](size_t size) {
+    if (void* ptr = allocate(size)) return ptr;
+    throw std::bad_alloc();
+}
+
+void* operator new(size_t size, const std::nothrow_t&) noexcept { return allocate(size); }
+void* operator new[](size_t size, const std::nothrow_t&) noexcept { return allocate(size); }
+
+void* operator new(size_t size, std::align_val_t alignment) {
+    if (void* ptr = allocate(size, static_cast<size_t>(alignment))) return ptr;
+    throw std::bad_alloc();
+}
+
+void* operator new[](size_t size, std::align_val_t alignment) {
+    if (void* ptr = allocate(size, static_cast<size_t>(alignment))) return ptr;
+    throw std::bad_alloc();
+}
+
+void operator delete(void* ptr) noexcept { deallocate(ptr); }
+void operator delete[](void* ptr) noexcept { deallocate(ptr); }
+void operator delete(void* ptr, size_t) noexcept { deallocate(ptr); }
+void operator delete[](void* ptr, size_t) noexcept { deallocate(ptr); }
+void operator delete(void* ptr, std::align_val_t) noexcept { deallocate(ptr); }
+void operator delete[](void* ptr, std::align_val_t) noexcept { deallocate(ptr); }
+void operator delete(void* ptr, size_t, std::align_val_t) noexcept { deallocate(ptr); }
+void operator delete[](void* ptr, size_t, std::align_val_t) noexcept { deallocate(ptr); }
+
+#endif // DELIVERB_RT_GUARD
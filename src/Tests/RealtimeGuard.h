@@ -0,0 +1,54 @@
+#pragma once
+
+#include <cstdint>
+
+namespace DeliVerb::Test {
+
+// Real-time safety checking for render entry points (Linux/glibc).
+//
+// RealtimeGuard.cpp interposes malloc/calloc/realloc/free, the aligned
+// allocators, global operator new/delete and pthread_mutex_lock. While a
+// RealtimeScope is alive on a thread, every call from that thread is counted
+// as a violation against the scope's name.
+
+enum class Violation : int {
+    Malloc = 0,
+    Free,
+    OperatorNew,
+    OperatorDelete,
+    MutexLock,
+    kCount
+};
+
+const char* violationName(Violation violation);
+
+// RAII marker for "this thread is inside a render call"
+class RealtimeScope {
+public:
+    explicit RealtimeScope(const char* entryPoint);
+    ~RealtimeScope();
+
+    RealtimeScope(const RealtimeScope&) = delete;
+    RealtimeScope& operator=(const RealtimeScope&) = delete;
+};
+
+struct ViolationReport {
+    uint64_t counts[static_cast<int>(Violation::kCount)] = {};
+    const char* firstEntryPoint = nullptr;   // Scope active at the first violation
+    Violation firstViolation = Violation::Malloc;
+
+    uint64_t total() const {
+        uint64_t sum = 0;
+        for (uint64_t count : counts) sum += count;
+        return sum;
+    }
+};
+
+// Snapshot of all violations since the last reset
+ViolationReport violationReport();
+void resetViolations();
+
+// False when the interposers are not active on this platform
+bool realtimeGuardAvailable();
+
+} // namespace DeliVerb::Test
@@ -0,0 +1,140 @@
+// Real-time safety test: no heap allocation, deallocation or mutex locking
+// may happen inside a render entry point, across parameter sweeps and
+// sample-rate switches. New render entry points belong in kEntryPoints.
+
+#include "DeliVerbDSP.h"
+#include "RealtimeGuard.h"
+
+#include <cstdio>
+#include <functional>
+#include <vector>
+
+using namespace DeliVerb;
+using namespace DeliVerb::Test;
+
+namespace {
+
+constexpr int kMaxFrames = 4096; // AU maximumFramesToRender
+
+struct Buffers {
+    std::vector<float> inL = std::vector<float>(kMaxFrames);
+    std::vector<float> inR = std::vector<float>(kMaxFrames);
+    std::vector<float> outL = std::vector<float>(kMaxFrames);
+    std::vector<float> outR = std::vector<float>(kMaxFrames);
+};
+
+struct EntryPoint {
+    const char* name;
+    std::function<void(DeliVerbDSP&, Buffers&, int numFrames)> render;
+};
+
+const EntryPoint kEntryPoints[] = {
+    {"DeliVerbDSP::processStereo", [](DeliVerbDSP& dsp, Buffers& b, int n) {
+        dsp.processStereo(b.inL.data(), b.inR.data(), b.outL.data(), b.outR.data(), n);
+    }},
+    {"DeliVerbDSP::processStereo (in place)", [](DeliVerbDSP& dsp, Buffers& b, int n) {
+        dsp.processStereo(b.outL.data(), b.outR.data(), b.outL.data(), b.outR.data(), n);
+    }},
+    {"DeliVerbDSP::process", [](DeliVerbDSP& dsp, Buffers& b, int n) {
+        dsp.process(b.inL.data(), b.outL.data(), b.outR.data(), n);
+    }},
+};
+
+// Parameter values to sweep through, including range extremes
+float sweepValue(DeliVerbDSP::ParamID param, int step) {
+    const float t = static_cast<float>(step % 5) / 4.0f;
+    switch (param) {
+        case DeliVerbDSP::kDelayTime:     return 50.0f + t * 1950.0f;
+        case DeliVerbDSP::kDelayRepeat:   return t * 0.95f;
+        case DeliVerbDSP::kDelayLowCut:
+        case DeliVerbDSP::kReverbLowCut:  return 20.0f + t * 1980.0f;
+        case DeliVerbDSP::kDelayHighCut:
+        case DeliVerbDSP::kReverbHighCut: return 1000.0f + t * 19000.0f;
+        default:                          return t;
+    }
+}
+
+bool reportViolations(const char* context) {
+    const ViolationReport report = violationReport();
+    if (report.total() == 0) return true;
+
+    std::fprintf(stderr, "FAIL %s: %llu real-time violation(s), first: %s in %s\n", context,
+                 static_cast<unsigned long long>(report.total()),
+                 violationName(report.firstViolation),
+                 report.firstEntryPoint ? report.firstEntryPoint : "?");
+    for (int i = 0; i < static_cast<int>(Violation::kCount); ++i) {
+        if (report.counts[i] > 0) {
+            std::fprintf(stderr, "     %-20s %llu\n", violationName(static_cast<Violation>(i)),
+                         static_cast<unsigned long long>(report.counts[i]));
+        }
+    }
+    resetViolations();
+    return false;
+}
+
+// The checker must notice a deliberate allocation, or a pass means nothing
+bool guardSelfTest() {
+    resetViolations();
+    {
+        RealtimeScope scope("self-test");
+        std::vector<float> allocation(16);
+        allocation[0] = 1.0f;
+    }
+    const ViolationReport report = violationReport();
+    resetViolations();
+    return report.counts[static_cast<int>(Violation::OperatorNew)] > 0;
+}
+
+} // namespace
+
+int main() {
+    if (!realtimeGuardAvailable()) {
+        std::printf("real-time guard unavailable on this platform, skipping\n");
+        return 0;
+    }
+    if (!guardSelfTest()) {
+        std::fprintf(stderr, "FAIL: allocation inside a RealtimeScope was not detected\n");
+        return 1;
+    }
+
+    Buffers buffers;
+    for (int i = 0; i < kMaxFrames; ++i) {
+        buffers.inL[i] = (i % 97 == 0) ? 0.8f : 0.0f;
+        buffers.inR[i] = (i % 89 == 0) ? -0.6f : 0.0f;
+    }
+
+    int failures = 0;
+    const int blockSizes[] = {1, 16, 64, 511, kMaxFrames};
+
+    for (const EntryPoint& entry : kEntryPoints) {
+        DeliVerbDSP dsp;
+
+        // Sample-rate switches happen outside the render call, as in the host
+        for (double sampleRate : {44100.0, 96000.0, 48000.0, 192000.0}) {
+            dsp.setSampleRate(sampleRate);
+            dsp.reset();
+            resetViolations();
+
+            int step = 0;
+            for (int blockSize : blockSizes) {
+                for (int param = 0; param < DeliVerbDSP::kNumParams; ++param, ++step) {
+                    // setParameter normally runs on a control thread, but the AUv2
+                    // wrapper's safety net and in-render parameter events can still
+                    // call it from the render thread, so it must stay RT-safe too
+                    RealtimeScope scope(entry.name);
+                    const auto id = static_cast<DeliVerbDSP::ParamID>(param);
+                    dsp.setParameter(id, sweepValue(id, step));
+                    entry.render(dsp, buffers, blockSize);
+                }
+            }
+
+            char context[128];
+            std::snprintf(context, sizeof(context), "%s @ %.0f Hz", entry.name, sampleRate);
+            if (!reportViolations(context)) ++failures;
+        }
+    }
+
+    if (failures > 0) return 1;
+    std::printf("real-time safety test passed\n");
+    return 0;
+}
@@ -0,0 +1,92 @@
+// Render deadline monitor test: a render thread drives DeliVerbDSP while a
+// reader thread snapshots the monitor concurrently (run under TSan with
+// -DDELIVERB_ENABLE_TSAN=ON to check the lock-free publication).
+
+#include "DeliVerbDSP.h"
+
+#include <atomic>
+#include <cstdio>
+#include <thread>
+#include <vector>
+
+using namespace DeliVerb;
+
+namespace {
+
+int g_failures = 0;
+
+void check(bool condition, const char* what) {
+    if (!condition) {
+        std::fprintf(stderr, "FAIL: %s\n", what);
+        ++g_failures;
+    }
+}
+
+uint64_t histogramTotal(const RenderMonitor::Snapshot& snap) {
+    uint64_t total = 0;
+    for (uint64_t count : snap.histogram) total += count;
+    return total;
+}
+
+} // namespace
+
+int main() {
+    constexpr int kBlockSize = 64;
+    constexpr int kNumBlocks = 3000;
+
+    DeliVerbDSP dsp;
+    dsp.setSampleRate(48000.0);
+    dsp.setParameter(DeliVerbDSP::kDelayTime, 420.0f);
+    dsp.setParameter(DeliVerbDSP::kReverbStyle, 0.75f);
+    dsp.reset();
+
+    std::vector<float> input(kBlockSize, 0.1f), outL(kBlockSize), outR(kBlockSize);
+    std::atomic<bool> rendering{true};
+    std::atomic<int> inconsistentSnapshots{0};
+
+    std::thread reader([&] {
+        uint64_t lastBlocks = 0;
+        while (rendering.load(std::memory_order_acquire)) {
+            const RenderMonitor::Snapshot snap = dsp.renderMonitor().snapshot();
+            // Counters only grow, and a published worst block is complete
+            if (snap.blocks < lastBlocks) inconsistentSnapshots.fetch_add(1);
+            if (snap.worst.numFrames != 0 && snap.worst.numFrames != kBlockSize) inconsistentSnapshots.fetch_add(1);
+            lastBlocks = snap.blocks;
+        }
+    });
+
+    std::thread renderThread([&] {
+        for (int block = 0; block < kNumBlocks; ++block) {
+            dsp.processStereo(input.data(), input.data(), outL.data(), outR.data(), kBlockSize);
+        }
+        rendering.store(false, std::memory_order_release);
+    });
+
+    renderThread.join();
+    reader.join();
+
+    const RenderMonitor::Snapshot snap = dsp.renderMonitor().snapshot();
+    check(inconsistentSnapshots.load() == 0, "concurrent snapshots are consistent");
+    check(snap.blocks == kNumBlocks, "every block is counted");
+    check(histogramTotal(snap) == snap.blocks, "histogram covers every block");
+    check(snap.worst.load > 0.0 && snap.worst.load >= snap.meanLoad, "worst block is at least the mean");
+    check(snap.worst.numFrames == kBlockSize, "worst block records its size");
+    check(snap.worst.numParams == DeliVerbDSP::kNumParams, "worst block records the parameters");
+    check(snap.worst.params[DeliVerbDSP::kDelayTime] == 420.0f, "parameter snapshot holds delay time");
+    check(snap.worst.params[DeliVerbDSP::kReverbStyle] == 0.75f, "parameter snapshot holds reverb style");
+
+    // An impossible deadline turns every block into a miss
+    dsp.renderMonitor().requestReset();
+    dsp.renderMonitor().setDeadlineFraction(0.0);
+    for (int block = 0; block < 10; ++block) {
+        dsp.processStereo(input.data(), input.data(), outL.data(), outR.data(), kBlockSize);
+    }
+    const RenderMonitor::Snapshot missed = dsp.renderMonitor().snapshot();
+    check(missed.blocks == 10, "reset clears the block count");
+    check(missed.deadlineMisses == 10, "blocks over the deadline count as misses");
+
+    if (g_failures > 0) return 1;
+    std::printf("render monitor test passed (%llu blocks, mean load %.4f, worst %.4f)\n",
+                static_cast<unsigned long long>(snap.blocks), snap.meanLoad, snap.worst.load);
+    return 0;
+}
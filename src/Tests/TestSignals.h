@@ -0,0 +1,56 @@
+#pragma once
+
+#include <cmath>
+#include <cstdint>
+#include <vector>
+
+namespace DeliVerb::Test {
+
+// Deterministic stimuli for rendering the engine offline.
+// All generators return one channel; stereo cases derive the right channel.
+
+inline std::vector<float> impulse(size_t numFrames, float amplitude = 1.0f) {
+    std::vector<float> buffer(numFrames, 0.0f);
+    if (numFrames > 0) buffer[0] = amplitude;
+    return buffer;
+}
+
+// Exponential sine sweep from f0 to f1 Hz over the whole buffer
+inline std::vector<float> sineSweep(size_t numFrames, double sampleRate,
+                                    double f0 = 20.0, double f1 = 20000.0, float amplitude = 0.5f) {
+    std::vector<float> buffer(numFrames);
+    const double duration = static_cast<double>(numFrames) / sampleRate;
+    const double k = std::log(f1 / f0);
+    for (size_t i = 0; i < numFrames; ++i) {
+        const double t = static_cast<double>(i) / sampleRate;
+        const double phase = 2.0 * M_PI * f0 * duration / k * (std::exp(t / duration * k) - 1.0);
+        buffer[i] = amplitude * static_cast<float>(std::sin(phase));
+    }
+    return buffer;
+}
+
+// White noise (LCG) in the first burstFrames, silence afterwards
+inline std::vector<float> noiseBurst(size_t numFrames, size_t burstFrames,
+                                     float amplitude = 0.5f, uint32_t seed = 0x2545F491u) {
+    std::vector<float> buffer(numFrames, 0.0f);
+    uint32_t state = seed;
+    for (size_t i = 0; i < burstFrames && i < numFrames; ++i) {
+        state = state * 1664525u + 1013904223u;
+        buffer[i] = amplitude * (static_cast<float>(state >> 8) / 8388608.0f - 1.0f);
+    }
+    return buffer;
+}
+
+// Short decaying tone followed by a long silent tail, exercising the
+// feedback paths once input stops
+inline std::vector<float> silenceTail(size_t numFrames, double sampleRate, size_t toneFrames) {
+    std::vector<float> buffer(numFrames, 0.0f);
+    for (size_t i = 0; i < toneFrames && i < numFrames; ++i) {
+        const double t = static_cast<double>(i) / sampleRate;
+        const double envelope = 1.0 - static_cast<double>(i) / static_cast<double>(toneFrames);
+        buffer[i] = static_cast<float>(0.6 * envelope * std::sin(2.0 * M_PI * 440.0 * t));
+    }
+    return buffer;
+}
+
+} // namespace DeliVerb::Test
@@ -0,0 +1,173 @@
+// deliverb_render - offline renderer for the DeliVerb DSP core
+//
+// Renders a WAV file or a generated test signal through DeliVerbDSP in host
+// sized blocks and optionally writes the result, a per-stage profile and a
+// Chrome trace (profiling builds only).
+//
+// Usage: deliverb_render [--input in.wav | --signal impulse|sweep|noise|tail]
+//                        [--output out.wav] [--preset NAME] [--set id=value]...
+//                        [--rate SR] [--seconds S] [--block N] [--mono] [--trace trace.json]
+
+#include "Presets.h"
+#include "TestSignals.h"
+#include "WavFile.h"
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <memory>
+#include <string>
+
+using namespace DeliVerb;
+
+namespace {
+
+void printUsage() {
+    std::printf("usage: deliverb_render [--input in.wav | --signal impulse|sweep|noise|tail] [--output out.wav]\n"
+                "                       [--preset NAME] [--set id=value]... [--rate SR] [--seconds S]\n"
+                "                       [--block N] [--mono] [--trace trace.json]\n");
+}
+
+bool makeSignal(const std::string& name, double sampleRate, double seconds, Tools::AudioFile& audio) {
+    const size_t numFrames = static_cast<size_t>(sampleRate * seconds);
+    std::vector<float> signal;
+    if (name == "impulse") {
+        signal = Test::impulse(numFrames);
+    } else if (name == "sweep") {
+        signal = Test::sineSweep(numFrames, sampleRate);
+    } else if (name == "noise") {
+        signal = Test::noiseBurst(numFrames, numFrames);
+    } else if (name == "tail") {
+        signal = Test::silenceTail(numFrames, sampleRate, static_cast<size_t>(sampleRate * 0.1));
+    } else {
+        return false;
+    }
+    audio.sampleRate = sampleRate;
+    audio.channels = {signal, signal};
+    return true;
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    std::string inputPath, outputPath, tracePath, signalName = "sweep";
+    const char* presetName = "Classic";
+    std::vector<std::pair<int, float>> overrides;
+    double sampleRate = 48000.0;
+    double seconds = 5.0;
+    int blockSize = 512;
+    bool mono = false;
+
+    for (int i = 1; i < argc; ++i) {
+        const std::string arg = argv[i];
+        const bool hasValue = i + 1 < argc;
+        if (arg == "--input" && hasValue) {
+            inputPath = argv[++i];
+        } else if (arg == "--signal" && hasValue) {
+            signalName = argv[++i];
+        } else if (arg == "--output" && hasValue) {
+            outputPath = argv[++i];
+        } else if (arg == "--preset" && hasValue) {
+            presetName = argv[++i];
+        } else if (arg == "--set" && hasValue) {
+            const std::string assignment = argv[++i];
+            const size_t eq = assignment.find('=');
+            const int param = eq == std::string::npos ? -1 : Bench::findParameter(assignment.substr(0, eq));
+            if (param < 0) {
+                std::fprintf(stderr, "unknown parameter in '%s'\n", assignment.c_str());
+                return 1;
+            }
+            overrides.emplace_back(param, std::strtof(assignment.c_str() + eq + 1, nullptr));
+        } else if (arg == "--rate" && hasValue) {
+            sampleRate = std::atof(argv[++i]);
+        } else if (arg == "--seconds" && hasValue) {
+            seconds = std::atof(argv[++i]);
+        } else if (arg == "--block" && hasValue) {
+            blockSize = std::max(1, std::atoi(argv[++i]));
+        } else if (arg == "--mono") {
+            mono = true;
+        } else if (arg == "--trace" && hasValue) {
+            tracePath = argv[++i];
+        } else {
+            printUsage();
+            return arg == "--help" || arg == "-h" ? 0 : 1;
+        }
+    }
+
+    Tools::AudioFile input;
+    std::string error;
+    if (!inputPath.empty()) {
+        if (!Tools::readWav(inputPath, input, error)) {
+            std::fprintf(stderr, "%s\n", error.c_str());
+            return 1;
+        }
+        if (input.channels.size() == 1) input.channels.push_back(input.channels[0]);
+    } else if (!makeSignal(signalName, sampleRate, seconds, input)) {
+        std::fprintf(stderr, "unknown signal '%s'\n", signalName.c_str());
+        return 1;
+    }
+
+    const Bench::Preset* preset = Bench::findPreset(presetName);
+    if (!preset) {
+        std::fprintf(stderr, "unknown preset '%s'\n", presetName);
+        return 1;
+    }
+
+    auto dsp = std::make_unique<DeliVerbDSP>();
+    dsp->setSampleRate(input.sampleRate);
+    preset->applyTo(*dsp);
+    for (const auto& [param, value] : overrides) {
+        dsp->setParameter(static_cast<DeliVerbDSP::ParamID>(param), value);
+    }
+    dsp->reset();
+
+    const size_t numFrames = input.numFrames();
+    Tools::AudioFile output;
+    output.sampleRate = input.sampleRate;
+    output.channels.assign(2, std::vector<float>(numFrames));
+
+    const auto start = std::chrono::steady_clock::now();
+    for (size_t pos = 0; pos < numFrames; pos += static_cast<size_t>(blockSize)) {
+        const int count = static_cast<int>(std::min<size_t>(blockSize, numFrames - pos));
+        if (mono) {
+            dsp->process(input.channels[0].data() + pos,
+                         output.channels[0].data() + pos, output.channels[1].data() + pos, count);
+        } else {
+            dsp->processStereo(input.channels[0].data() + pos, input.channels[1].data() + pos,
+                               output.channels[0].data() + pos, output.channels[1].data() + pos, count);
+        }
+    }
+    const double elapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    const double audioSeconds = static_cast<double>(numFrames) / input.sampleRate;
+
+    std::printf("rendered %zu frames (%.2f s) at %.0f Hz, preset %s, block %d: %.3f s, %.1fx realtime\n",
+                numFrames, audioSeconds, input.sampleRate, preset->name, blockSize,
+                elapsed, elapsed > 0.0 ? audioSeconds / elapsed : 0.0);
+
+    const RenderMonitor::Snapshot monitor = dsp->renderMonitor().snapshot();
+    std::printf("blocks %llu, mean load %.2f%%, worst %.2f%% (block %llu, %d frames), deadline misses %llu\n",
+                static_cast<unsigned long long>(monitor.blocks), 100.0 * monitor.meanLoad,
+                100.0 * monitor.worst.load, static_cast<unsigned long long>(monitor.worst.blockIndex),
+                monitor.worst.numFrames, static_cast<unsigned long long>(monitor.deadlineMisses));
+
+#if DELIVERB_PROFILING
+    StageProfiler::instance().writeSummary(stdout);
+    if (!tracePath.empty()) {
+        if (FILE* trace = std::fopen(tracePath.c_str(), "w")) {
+            StageProfiler::instance().writeChromeTrace(trace);
+            std::fclose(trace);
+            std::printf("wrote trace %s\n", tracePath.c_str());
+        }
+    }
+#else
+    if (!tracePath.empty()) {
+        std::fprintf(stderr, "--trace needs a build with -DDELIVERB_ENABLE_PROFILING=ON\n");
+    }
+#endif
+
+    if (!outputPath.empty() && !Tools::writeWav(outputPath, output)) {
+        std::fprintf(stderr, "cannot write %s\n", outputPath.c_str());
+        return 1;
+    }
+    return 0;
+}
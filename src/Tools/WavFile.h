@@ -0,0 +1,136 @@
+#pragma once
+
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <string>
+#include <vector>
+
+namespace DeliVerb::Tools {
+
+// Minimal RIFF/WAVE reader and writer for the offline tools.
+// Reads 16/24/32-bit PCM and 32-bit float; writes 32-bit float.
+struct AudioFile {
+    double sampleRate = 48000.0;
+    std::vector<std::vector<float>> channels;
+
+    size_t numFrames() const { return channels.empty() ? 0 : channels[0].size(); }
+};
+
+namespace detail {
+
+inline uint32_t readLE(const uint8_t* p, int bytes) {
+    uint32_t value = 0;
+    for (int i = 0; i < bytes; ++i) value |= static_cast<uint32_t>(p[i]) << (8 * i);
+    return value;
+}
+
+inline void writeLE(FILE* file, uint32_t value, int bytes) {
+    for (int i = 0; i < bytes; ++i) std::fputc(static_cast<int>((value >> (8 * i)) & 0xFF), file);
+}
+
+} // namespace detail
+
+inline bool readWav(const std::string& path, AudioFile& audio, std::string& error) {
+    FILE* file = std::fopen(path.c_str(), "rb");
+    if (!file) {
+        error = "cannot open " + path;
+        return false;
+    }
+    std::vector<uint8_t> bytes;
+    uint8_t chunk[65536];
+    size_t count;
+    while ((count = std::fread(chunk, 1, sizeof(chunk), file)) > 0) bytes.insert(bytes.end(), chunk, chunk + count);
+    std::fclose(file);
+
+    if (bytes.size() < 12 || std::memcmp(bytes.data(), "RIFF", 4) != 0 || std::memcmp(bytes.data() + 8, "WAVE", 4) != 0) {
+        error = path + " is not a RIFF/WAVE file";
+        return false;
+    }
+
+    int format = 0, numChannels = 0, bitsPerSample = 0;
+    const uint8_t* data = nullptr;
+    size_t dataSize = 0;
+
+    for (size_t pos = 12; pos + 8 <= bytes.size();) {
+        const uint8_t* header = bytes.data() + pos;
+        const size_t size = detail::readLE(header + 4, 4);
+        const uint8_t* body = header + 8;
+        if (pos + 8 + size > bytes.size()) break;
+
+        if (std::memcmp(header, "fmt ", 4) == 0 && size >= 16) {
+            format = static_cast<int>(detail::readLE(body, 2));
+            numChannels = static_cast<int>(detail::readLE(body + 2, 2));
+            audio.sampleRate = detail::readLE(body + 4, 4);
+            bitsPerSample = static_cast<int>(detail::readLE(body + 14, 2));
+            if (format == 0xFFFE && size >= 26) format = static_cast<int>(detail::readLE(body + 24, 2));
+        } else if (std::memcmp(header, "data", 4) == 0) {
+            data = body;
+            dataSize = size;
+        }
+        pos += 8 + size + (size & 1);
+    }
+
+    const bool supported = (format == 1 && (bitsPerSample == 16 || bitsPerSample == 24 || bitsPerSample == 32))
+                           || (format == 3 && bitsPerSample == 32);
+    if (!data || numChannels <= 0 || !supported) {
+        error = path + ": unsupported WAV format (need 16/24/32-bit PCM or 32-bit float)";
+        return false;
+    }
+
+    const int bytesPerSample = bitsPerSample / 8;
+    const size_t numFrames = dataSize / static_cast<size_t>(bytesPerSample * numChannels);
+    audio.channels.assign(static_cast<size_t>(numChannels), std::vector<float>(numFrames));
+
+    for (size_t frame = 0; frame < numFrames; ++frame) {
+        for (int ch = 0; ch < numChannels; ++ch) {
+            const uint8_t* p = data + (frame * numChannels + ch) * bytesPerSample;
+            float value;
+            if (format == 3) {
+                const uint32_t bits = detail::readLE(p, 4);
+                std::memcpy(&value, &bits, sizeof(value));
+            } else {
+                // Sign-extend to 32 bits, then scale to [-1, 1)
+                const uint32_t raw = detail::readLE(p, bytesPerSample) << (32 - bitsPerSample);
+                value = static_cast<float>(static_cast<int32_t>(raw) / 2147483648.0);
+            }
+            audio.channels[ch][frame] = value;
+        }
+    }
+    return true;
+}
+
+inline bool writeWav(const std::string& path, const AudioFile& audio) {
+    FILE* file = std::fopen(path.c_str(), "wb");
+    if (!file) return false;
+
+    const uint32_t numChannels = static_cast<uint32_t>(audio.channels.size());
+    const uint32_t dataSize = static_cast<uint32_t>(audio.numFrames() * numChannels * 4);
+
+    std::fwrite("RIFF", 1, 4, file);
+    detail::writeLE(file, 36 + dataSize, 4);
+    std::fwrite("WAVEfmt ", 1, 8, file);
+    detail::writeLE(file, 16, 4);
+    detail::writeLE(file, 3, 2); // IEEE float
+    detail::writeLE(file, numChannels, 2);
+    detail::writeLE(file, static_cast<uint32_t>(audio.sampleRate), 4);
+    detail::writeLE(file, static_cast<uint32_t>(audio.sampleRate) * numChannels * 4, 4);
+    detail::writeLE(file, numChannels * 4, 2);
+    detail::writeLE(file, 32, 2);
+    std::fwrite("data", 1, 4, file);
+    detail::writeLE(file, dataSize, 4);
+
+    for (size_t frame = 0; frame < audio.numFrames(); ++frame) {
+        for (const auto& channel : audio.channels) {
+            uint32_t bits;
+            std::memcpy(&bits, &channel[frame], sizeof(bits));
+            detail::writeLE(file, bits, 4);
+        }
+    }
+
+    const bool ok = std::ferror(file) == 0;
+    std::fclose(file);
+    return ok;
+}
+
+} // namespace DeliVerb::Tools